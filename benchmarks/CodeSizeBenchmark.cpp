@@ -0,0 +1,46 @@
+#include "../source/SimpleLog.ipp"
+
+// Five call sites with different levels, templates and argument types
+#define SITES_5(n) \
+	LogInformation("Information " #n " {}", number); \
+	LogWarning("Warning " #n " {} {}", number, real); \
+	LogDebug("Debug " #n " {}", text); \
+	LogError("Error " #n " {} {} {}", number, text, real); \
+	LogTrace("Trace " #n)
+#define SITES_50(n) SITES_5(n##0); SITES_5(n##1); SITES_5(n##2); SITES_5(n##3); SITES_5(n##4); SITES_5(n##5); SITES_5(n##6); SITES_5(n##7); SITES_5(n##8); SITES_5(n##9)
+#define SITES_500(n) SITES_50(n##0); SITES_50(n##1); SITES_50(n##2); SITES_50(n##3); SITES_50(n##4); SITES_50(n##5); SITES_50(n##6); SITES_50(n##7); SITES_50(n##8); SITES_50(n##9)
+
+/**
+* @brief A translation unit with 1,000 distinct call sites, which shows how much code every call site adds to the binary.
+*
+* Usage: g++ -std=c++20 -O2 -pthread benchmarks/CodeSizeBenchmark.cpp -o CodeSizeBenchmark && size CodeSizeBenchmark
+*
+* @author Narumikazuchi
+* @date 16.10.2026
+*/
+void CallSites(
+	int number,
+	double real,
+	const std::string& text
+) {
+	SITES_500(1);
+	SITES_500(2);
+}
+
+int main(
+	int argc,
+	char**
+) {
+	SimpleLog::LoggerConfiguration configuration = SimpleLog::LoggerConfiguration();
+	configuration.WriteToFile = false;
+	configuration.WriteToConsole = false;
+	SimpleLog::ConfigureLogger(
+		configuration
+	);
+	CallSites(
+		argc,
+		1.5,
+		"text"
+	);
+	return 0;
+}
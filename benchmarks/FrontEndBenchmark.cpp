@@ -0,0 +1,405 @@
+#include "../source/SimpleLog.ipp"
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+	// Every allocation of the process is counted, so the allocations of a call can be reported
+	std::atomic<uint64_t> allocations = 0ULL;
+
+	/**
+	* @brief Converts implicitly into a string view (`_StringConvertible`).
+	*/
+	struct Convertible final
+	{
+	public:
+		operator std::string_view() const
+		{
+			return "convertible";
+		};
+	};
+
+	/**
+	* @brief Provides its own string representation (`_Stringify`).
+	*/
+	struct Stringify final
+	{
+	public:
+		const std::string& ToString() const
+		{
+			return m_Value;
+		};
+
+	private:
+		std::string m_Value = "stringify";
+	};
+
+	/**
+	* @brief Discards everything written to it, so the console output can be measured without a terminal.
+	*/
+	struct NullBuffer final : std::streambuf
+	{
+	public:
+		int overflow(
+			int character
+		) override {
+			return character;
+		};
+
+		std::streamsize xsputn(
+			const char*,
+			std::streamsize count
+		) override {
+			return count;
+		};
+	};
+
+	/**
+	* @brief The result of a single benchmark case.
+	*/
+	struct Result final
+	{
+	public:
+		std::string Case = std::string();
+		std::string_view Sink = std::string_view();
+		bool WriteThreadId = false;
+		double Nanoseconds = 0.0;
+		double Allocations = 0.0;
+	};
+
+	/**
+	* @brief Runs a call `iterations` times after a short warm-up and measures the average time and allocations.
+	*/
+	template <typename TCall>
+	Result Measure(
+		std::string name,
+		size_t iterations,
+		TCall&& call
+	) {
+		size_t index = 0ULL;
+		while (index < iterations / 10ULL + 1ULL)
+		{
+			call();
+			index += 1ULL;
+		}
+
+		uint64_t allocated = allocations.load(
+			std::memory_order_relaxed
+		);
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		index = 0ULL;
+		while (index < iterations)
+		{
+			call();
+			index += 1ULL;
+		}
+
+		std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+		Result result = Result();
+		result.Case = std::move(name);
+		result.Nanoseconds = static_cast<double>(elapsed.count()) / static_cast<double>(iterations);
+		result.Allocations = static_cast<double>(allocations.load(std::memory_order_relaxed) - allocated) / static_cast<double>(iterations);
+		return result;
+	};
+
+	/**
+	* @brief Runs every case against the current configuration.
+	*/
+	void RunCases(
+		std::vector<Result>& results,
+		size_t iterations,
+		std::string_view sink,
+		bool writeThreadId
+	) {
+		const std::string string = "string";
+		const std::string_view view = "view";
+		const char* pointer = "pointer";
+		const Convertible convertible = Convertible();
+		const Stringify stringify = Stringify();
+		size_t first = results.size();
+
+		// Discarded because of the level
+		results.push_back(Measure("filtered", iterations, [&]() { LogDebug("Filtered {}", 42); }));
+
+		// Every kind of argument `UnrollArgument` handles (types that only cast explicitly are not `_Loggable`)
+		results.push_back(Measure("argument std::string", iterations, [&]() { LogInformation("Argument {}", string); }));
+		results.push_back(Measure("argument std::string_view", iterations, [&]() { LogInformation("Argument {}", view); }));
+		results.push_back(Measure("argument const char*", iterations, [&]() { LogInformation("Argument {}", pointer); }));
+		results.push_back(Measure("argument convertible", iterations, [&]() { LogInformation("Argument {}", convertible); }));
+		results.push_back(Measure("argument int", iterations, [&]() { LogInformation("Argument {}", 42); }));
+		results.push_back(Measure("argument double", iterations, [&]() { LogInformation("Argument {}", 3.14159); }));
+		results.push_back(Measure("argument ToString", iterations, [&]() { LogInformation("Argument {}", stringify); }));
+		results.push_back(Measure("argument char", iterations, [&]() { LogInformation("Argument {}", 'c'); }));
+		results.push_back(Measure("argument Field", iterations, [&]() { LogInformation("Argument {value}", SimpleLog::Field("value", 42)); }));
+
+		// Zero to eight placeholders
+		results.push_back(Measure("placeholders 0", iterations, [&]() { LogInformation("Placeholders"); }));
+		results.push_back(Measure("placeholders 1", iterations, [&]() { LogInformation("Placeholders {}", 1); }));
+		results.push_back(Measure("placeholders 2", iterations, [&]() { LogInformation("Placeholders {} {}", 1, 2); }));
+		results.push_back(Measure("placeholders 3", iterations, [&]() { LogInformation("Placeholders {} {} {}", 1, 2, 3); }));
+		results.push_back(Measure("placeholders 4", iterations, [&]() { LogInformation("Placeholders {} {} {} {}", 1, 2, 3, 4); }));
+		results.push_back(Measure("placeholders 5", iterations, [&]() { LogInformation("Placeholders {} {} {} {} {}", 1, 2, 3, 4, 5); }));
+		results.push_back(Measure("placeholders 6", iterations, [&]() { LogInformation("Placeholders {} {} {} {} {} {}", 1, 2, 3, 4, 5, 6); }));
+		results.push_back(Measure("placeholders 7", iterations, [&]() { LogInformation("Placeholders {} {} {} {} {} {} {}", 1, 2, 3, 4, 5, 6, 7); }));
+		results.push_back(Measure("placeholders 8", iterations, [&]() { LogInformation("Placeholders {} {} {} {} {} {} {} {}", 1, 2, 3, 4, 5, 6, 7, 8); }));
+
+		while (first < results.size())
+		{
+			results[first].Sink = sink;
+			results[first].WriteThreadId = writeThreadId;
+			first += 1ULL;
+		}
+	};
+}
+
+#ifdef __GLIBC__
+// Every allocation of the C and the C++ library ends up in these, the default operator new included
+extern "C"
+{
+	void* __libc_malloc(size_t size);
+	void* __libc_calloc(size_t count, size_t size);
+	void* __libc_realloc(void* memory, size_t size);
+
+	void* malloc(
+		size_t size
+	) {
+		allocations.fetch_add(
+			1ULL,
+			std::memory_order_relaxed
+		);
+		return __libc_malloc(
+			size
+		);
+	}
+
+	void* calloc(
+		size_t count,
+		size_t size
+	) {
+		allocations.fetch_add(
+			1ULL,
+			std::memory_order_relaxed
+		);
+		return __libc_calloc(
+			count,
+			size
+		);
+	}
+
+	void* realloc(
+		void* memory,
+		size_t size
+	) {
+		allocations.fetch_add(
+			1ULL,
+			std::memory_order_relaxed
+		);
+		return __libc_realloc(
+			memory,
+			size
+		);
+	}
+}
+#else
+// The replacements pair malloc with free, which GCC cannot see through once they are inlined
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif // __GNUC__
+
+void* operator new(
+	size_t size
+) {
+	allocations.fetch_add(
+		1ULL,
+		std::memory_order_relaxed
+	);
+	void* memory = std::malloc(
+		size == 0ULL ? 1ULL : size
+	);
+	if (memory == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return memory;
+}
+
+void* operator new[](
+	size_t size
+) {
+	return operator new(
+		size
+	);
+}
+
+void operator delete(
+	void* memory
+) noexcept {
+	std::free(
+		memory
+	);
+}
+
+void operator delete(
+	void* memory,
+	size_t
+) noexcept {
+	std::free(
+		memory
+	);
+}
+
+void operator delete[](
+	void* memory
+) noexcept {
+	std::free(
+		memory
+	);
+}
+
+void operator delete[](
+	void* memory,
+	size_t
+) noexcept {
+	std::free(
+		memory
+	);
+}
+#endif // __GLIBC__
+
+/**
+* @brief Measures the cost of a single `LogX` call for every kind of argument, number of placeholders and output and writes the results as JSON.
+*
+* Usage: FrontEndBenchmark [--iterations <count>] [--output <file>] [--allocation-free]
+*
+* With `--allocation-free` the logger runs with `AllocationFree` set and the benchmark fails if any logging call still allocates after the warm-up.
+* With glibc every `malloc`, `calloc` and `realloc` is counted, otherwise only `operator new`. The cases only write plain messages; scopes, backtraces and summaries allocate by design (see `AllocationFree`).
+*
+* @author Narumikazuchi
+* @date 16.10.2026
+*/
+int main(
+	int argc,
+	char** argv
+) {
+	size_t iterations = 20000ULL;
+	std::filesystem::path output = std::filesystem::path();
+	bool allocationFree = false;
+	int index = 1;
+	while (index < argc)
+	{
+		std::string_view option = std::string_view(argv[index]);
+		if (option == "--allocation-free")
+		{
+			allocationFree = true;
+			index += 1;
+			continue;
+		}
+
+		if (index + 1 >= argc)
+		{
+			break;
+		}
+
+		if (option == "--iterations")
+		{
+			iterations = std::max<size_t>(
+				std::strtoull(argv[index + 1], nullptr, 10),
+				1ULL
+			);
+		}
+		else if (option == "--output")
+		{
+			output = argv[index + 1];
+		}
+
+		index += 2;
+	}
+
+	std::filesystem::path directory = std::filesystem::temp_directory_path() / "SimpleLogBenchmark";
+	std::vector<Result> results = std::vector<Result>();
+	NullBuffer discard = NullBuffer();
+	std::streambuf* console = std::cout.rdbuf(
+		&discard
+	);
+	for (const std::string_view sink : { "null", "console", "file" })
+	{
+		for (const bool writeThreadId : { false, true })
+		{
+			SimpleLog::LoggerConfiguration configuration = SimpleLog::LoggerConfiguration();
+			configuration.LogDirectory = directory;
+			configuration.Severity = SimpleLog::LogLevels::Information;
+			configuration.WriteThreadId = writeThreadId;
+			configuration.WriteToConsole = sink == "console";
+			configuration.WriteToFile = sink == "file";
+			configuration.AllocationFree = allocationFree;
+			SimpleLog::ConfigureLogger(
+				configuration
+			);
+			RunCases(
+				results,
+				iterations,
+				sink,
+				writeThreadId
+			);
+		}
+	}
+
+	std::cout.rdbuf(
+		console
+	);
+	std::filesystem::remove_all(
+		directory
+	);
+
+	std::string json = std::string();
+	json += "{\"benchmark\":\"front-end\",\"iterations\":";
+	json += std::to_string(iterations);
+	json += ",\"results\":[";
+	for (const Result& result : results)
+	{
+		char buffer[256];
+		std::snprintf(
+			buffer,
+			sizeof(buffer),
+			"%s\n{\"case\":\"%s\",\"sink\":\"%.*s\",\"thread_id\":%s,\"ns_per_call\":%.1f,\"allocations_per_call\":%.2f}",
+			&result == &results.front() ? "" : ",",
+			result.Case.c_str(),
+			static_cast<int>(result.Sink.size()),
+			result.Sink.data(),
+			result.WriteThreadId == true ? "true" : "false",
+			result.Nanoseconds,
+			result.Allocations
+		);
+		json += buffer;
+	}
+
+	json += "\n]}\n";
+
+	// Every case counts, since a single allocating argument type is enough to stall the caller
+	int status = 0;
+	if (allocationFree == true)
+	{
+		for (const Result& result : results)
+		{
+			if (result.Allocations > 0.0)
+			{
+				std::cerr << "Allocates: " << result.Case << " (" << result.Sink << (result.WriteThreadId == true ? ", thread id" : "") << ") " << result.Allocations << " per call\n";
+				status = 1;
+			}
+		}
+	}
+
+	if (output.empty() == true)
+	{
+		std::cout << json;
+		return status;
+	}
+
+	std::ofstream file(
+		output
+	);
+	file << json;
+	return file.good() == true ? status : 1;
+}
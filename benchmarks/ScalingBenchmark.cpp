@@ -0,0 +1,407 @@
+#include "../source/SimpleLog.ipp"
+
+#include <cstdlib>
+#include <optional>
+
+namespace
+{
+	/**
+	* @brief A log-linear latency histogram: every power of two is split into 32 sub-buckets, so a percentile is off by at most about 3%.
+	*/
+	struct Histogram final
+	{
+	public:
+		static constexpr size_t SubBucketBits = 6ULL;
+		static constexpr size_t SubBuckets = 1ULL << SubBucketBits;
+
+		std::array<uint64_t, 64ULL * SubBuckets> Counts = { };
+		uint64_t Total = 0ULL;
+		uint64_t Max = 0ULL;
+
+		/**
+		* @brief Records a value, which costs a bit scan and an increment.
+		*/
+		inline void Record(
+			uint64_t value
+		) {
+			this->Counts[Index(value)] += 1ULL;
+			this->Total += 1ULL;
+			this->Max = std::max<uint64_t>(
+				this->Max,
+				value
+			);
+		};
+
+		inline void Merge(
+			const Histogram& other
+		) {
+			size_t index = 0ULL;
+			while (index < this->Counts.size())
+			{
+				this->Counts[index] += other.Counts[index];
+				index += 1ULL;
+			}
+
+			this->Total += other.Total;
+			this->Max = std::max<uint64_t>(
+				this->Max,
+				other.Max
+			);
+		};
+
+		/**
+		* @brief The smallest value that is at least as large as the given percentage of all values.
+		*/
+		inline uint64_t Percentile(
+			double percentile
+		) const {
+			uint64_t rank = std::max<uint64_t>(
+				static_cast<uint64_t>(std::ceil(static_cast<double>(this->Total) * percentile / 100.0)),
+				1ULL
+			);
+			uint64_t seen = 0ULL;
+			size_t index = 0ULL;
+			while (index < this->Counts.size())
+			{
+				seen += this->Counts[index];
+				if (seen >= rank)
+				{
+					return std::min<uint64_t>(
+						UpperBound(index),
+						this->Max
+					);
+				}
+
+				index += 1ULL;
+			}
+
+			return this->Max;
+		};
+
+	private:
+		static inline size_t Index(
+			uint64_t value
+		) {
+			if (value < SubBuckets)
+			{
+				return static_cast<size_t>(value);
+			}
+
+			size_t magnitude = static_cast<size_t>(std::bit_width(value)) - SubBucketBits;
+			return magnitude * SubBuckets + static_cast<size_t>(value >> magnitude);
+		};
+
+		static inline uint64_t UpperBound(
+			size_t index
+		) {
+			size_t magnitude = index / SubBuckets;
+			if (magnitude == 0ULL)
+			{
+				return index;
+			}
+
+			uint64_t subBucket = index % SubBuckets;
+			return ((subBucket + 1ULL) << magnitude) - 1ULL;
+		};
+	};
+
+	/**
+	* @brief The logger modes that are measured; every mode writes the same message.
+	*/
+	enum class Mode
+	{
+		File,			///< Every message is written synchronously to a file.
+		Scoped,			///< Messages are buffered in a `Scope`, which ends normally every 64 messages.
+		FlightRecorder,	///< Debug messages only go into the memory-mapped flight recorder.
+		Backtrace,		///< Debug messages only go into the in-memory backtrace ring.
+	};
+
+	/**
+	* @brief Logs a single message the way the mode requires.
+	*/
+	inline void LogMessage(
+		Mode mode,
+		size_t thread,
+		uint64_t index
+	) {
+		if (mode == Mode::File)
+		{
+			LogWarning("Request {} of thread {} done", index, thread);
+		}
+		else
+		{
+			LogDebug("Request {} of thread {} done", index, thread);
+		}
+	};
+
+	/**
+	* @brief What a single producer thread has measured.
+	*/
+	struct Producer final
+	{
+	public:
+		Histogram Latency = Histogram();
+		uint64_t Calls = 0ULL;
+	};
+
+	/**
+	* @brief Runs a producer. Every call has an intended start time on a fixed schedule; its latency is measured from that time instead of from when it actually started, so a stalled call also counts against the calls that had to wait for it (coordinated omission).
+	* @param interval The time between two calls; zero logs as fast as possible and only measures throughput.
+	*/
+	inline void RunProducer(
+		Producer& producer,
+		Mode mode,
+		size_t thread,
+		std::chrono::steady_clock::time_point start,
+		std::chrono::steady_clock::time_point end,
+		std::chrono::nanoseconds interval
+	) {
+		std::optional<SimpleLog::Scope> scope = std::optional<SimpleLog::Scope>();
+		std::chrono::steady_clock::time_point intended = start;
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		while (now < end)
+		{
+			if (mode == Mode::Scoped
+				&& producer.Calls % 64ULL == 0ULL)
+			{
+				scope.reset();
+				scope.emplace(
+					SimpleLog::LogLevels::Debug
+				);
+			}
+
+			if (interval.count() > 0)
+			{
+				while (now < intended)
+				{
+					now = std::chrono::steady_clock::now();
+				}
+			}
+			else
+			{
+				intended = now;
+			}
+
+			LogMessage(
+				mode,
+				thread,
+				producer.Calls
+			);
+			now = std::chrono::steady_clock::now();
+			producer.Latency.Record(
+				static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - intended).count())
+			);
+			producer.Calls += 1ULL;
+			intended += interval;
+		}
+	};
+
+	/**
+	* @brief Runs the given number of producers at the same time and merges what they have measured.
+	*/
+	inline Producer RunProducers(
+		Mode mode,
+		size_t threads,
+		std::chrono::milliseconds duration,
+		std::chrono::nanoseconds interval,
+		double& seconds
+	) {
+		std::vector<Producer> producers = std::vector<Producer>(threads);
+		std::vector<std::thread> workers = std::vector<std::thread>();
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now() + std::chrono::milliseconds(10);
+		std::chrono::steady_clock::time_point end = start + duration;
+		size_t index = 0ULL;
+		while (index < threads)
+		{
+			workers.emplace_back(
+				RunProducer,
+				std::ref(producers[index]),
+				mode,
+				index,
+				start,
+				end,
+				interval
+			);
+			index += 1ULL;
+		}
+
+		for (std::thread& worker : workers)
+		{
+			worker.join();
+		}
+
+		seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		Producer merged = Producer();
+		for (const Producer& producer : producers)
+		{
+			merged.Latency.Merge(
+				producer.Latency
+			);
+			merged.Calls += producer.Calls;
+		}
+
+		return merged;
+	};
+}
+
+/**
+* @brief Measures how the throughput and the latency of the logger scale from one producer thread up to the number of cores and writes the results as JSON.
+*
+* Every thread count runs twice: once as fast as possible for the aggregate throughput and once at a fixed rate per thread for the latency percentiles.
+* Usage: ScalingBenchmark [--threads <maximum>] [--duration <milliseconds>] [--rate <calls per second and thread>] [--output <file>]
+*
+* @author Narumikazuchi
+* @date 16.10.2026
+*/
+int main(
+	int argc,
+	char** argv
+) {
+	size_t maximumThreads = std::max<size_t>(
+		std::thread::hardware_concurrency(),
+		1ULL
+	);
+	std::chrono::milliseconds duration = std::chrono::milliseconds(1000);
+	double rate = 20000.0;
+	std::filesystem::path output = std::filesystem::path();
+	int index = 1;
+	while (index + 1 < argc)
+	{
+		std::string_view option = std::string_view(argv[index]);
+		if (option == "--threads")
+		{
+			maximumThreads = std::max<size_t>(
+				std::strtoull(argv[index + 1], nullptr, 10),
+				1ULL
+			);
+		}
+		else if (option == "--duration")
+		{
+			duration = std::chrono::milliseconds(std::strtoll(argv[index + 1], nullptr, 10));
+		}
+		else if (option == "--rate")
+		{
+			rate = std::max<double>(
+				std::strtod(argv[index + 1], nullptr),
+				1.0
+			);
+		}
+		else if (option == "--output")
+		{
+			output = argv[index + 1];
+		}
+
+		index += 2;
+	}
+
+	// 1, 2, 4, ... and the maximum itself
+	std::vector<size_t> threadCounts = std::vector<size_t>();
+	size_t threads = 1ULL;
+	while (threads < maximumThreads)
+	{
+		threadCounts.push_back(
+			threads
+		);
+		threads *= 2ULL;
+	}
+
+	threadCounts.push_back(
+		maximumThreads
+	);
+
+	std::filesystem::path directory = std::filesystem::temp_directory_path() / "SimpleLogScaling";
+	const std::chrono::nanoseconds interval = std::chrono::nanoseconds(static_cast<int64_t>(1e9 / rate));
+	const std::array<std::pair<Mode, std::string_view>, 4ULL> modes = {
+		std::pair<Mode, std::string_view>(Mode::File, "file"),
+		std::pair<Mode, std::string_view>(Mode::Scoped, "scoped"),
+		std::pair<Mode, std::string_view>(Mode::FlightRecorder, "flight-recorder"),
+		std::pair<Mode, std::string_view>(Mode::Backtrace, "backtrace")
+	};
+
+	std::string json = std::string();
+	json += "{\"benchmark\":\"scaling\",\"duration_ms\":";
+	json += std::to_string(duration.count());
+	json += ",\"rate_per_thread\":";
+	json += std::to_string(static_cast<uint64_t>(rate));
+	json += ",\"results\":[";
+	bool first = true;
+	for (const std::pair<Mode, std::string_view>& mode : modes)
+	{
+		SimpleLog::LoggerConfiguration configuration = SimpleLog::LoggerConfiguration();
+		configuration.LogDirectory = directory;
+		configuration.Severity = SimpleLog::LogLevels::Warning;
+		if (mode.first == Mode::FlightRecorder)
+		{
+			configuration.FlightRecorderFile = directory / "flight.bin";
+		}
+		else if (mode.first == Mode::Backtrace)
+		{
+			configuration.BacktraceSize = 4096ULL;
+		}
+
+		SimpleLog::ConfigureLogger(
+			configuration
+		);
+		for (const size_t count : threadCounts)
+		{
+			double throughputSeconds = 0.0;
+			Producer throughput = RunProducers(
+				mode.first,
+				count,
+				duration,
+				std::chrono::nanoseconds(0),
+				throughputSeconds
+			);
+			double latencySeconds = 0.0;
+			Producer latency = RunProducers(
+				mode.first,
+				count,
+				duration,
+				interval,
+				latencySeconds
+			);
+
+			char buffer[512];
+			std::snprintf(
+				buffer,
+				sizeof(buffer),
+				"%s\n{\"mode\":\"%.*s\",\"threads\":%zu,\"calls_per_second\":%.0f,\"p50_ns\":%llu,\"p99_ns\":%llu,\"p999_ns\":%llu,\"max_ns\":%llu,\"achieved_rate\":%.0f}",
+				first == true ? "" : ",",
+				static_cast<int>(mode.second.size()),
+				mode.second.data(),
+				count,
+				static_cast<double>(throughput.Calls) / throughputSeconds,
+				static_cast<unsigned long long>(latency.Latency.Percentile(50.0)),
+				static_cast<unsigned long long>(latency.Latency.Percentile(99.0)),
+				static_cast<unsigned long long>(latency.Latency.Percentile(99.9)),
+				static_cast<unsigned long long>(latency.Latency.Max),
+				static_cast<double>(latency.Calls) / latencySeconds
+			);
+			json += buffer;
+			first = false;
+		}
+	}
+
+	json += "\n]}\n";
+
+	// Turns the flight recorder off before its file is removed
+	SimpleLog::LoggerConfiguration configuration = SimpleLog::LoggerConfiguration();
+	configuration.LogDirectory = directory;
+	SimpleLog::ConfigureLogger(
+		configuration
+	);
+	std::filesystem::remove_all(
+		directory
+	);
+	if (output.empty() == true)
+	{
+		std::cout << json;
+		return 0;
+	}
+
+	std::ofstream file(
+		output
+	);
+	file << json;
+	return file.good() == true ? 0 : 1;
+}
@@ -0,0 +1,14 @@
+/**
+* @brief The compiled backend of SimpleLog: formatting, the outputs and the configuration, built once into a static or shared library.
+*
+* Every translation unit that uses the library has to be compiled with `SIMPLELOG_COMPILED` as well; they include SimpleLog.hpp to log and SimpleLog.ipp to configure the logger.
+*
+* @author Narumikazuchi
+* @date 16.10.2026
+*/
+#ifndef SIMPLELOG_COMPILED
+#define SIMPLELOG_COMPILED
+#endif // SIMPLELOG_COMPILED
+#define SIMPLELOG_BACKEND
+
+#include "SimpleLog.ipp"
@@ -0,0 +1,2180 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// Keeps the parts of a logging call that only run once a message is enabled out of the code of the caller
+#if defined(__GNUC__) || defined(__clang__)
+#define SIMPLELOG_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+#define SIMPLELOG_COLD __declspec(noinline)
+#else
+#define SIMPLELOG_COLD
+#endif // __GNUC__ or _MSC_VER
+
+// Functions the front-end only declares: inline when header-only, compiled once into the backend with SIMPLELOG_COMPILED
+// A shared backend (SIMPLELOG_SHARED) exports them explicitly, so applications built with hidden visibility still link against it
+#ifdef SIMPLELOG_COMPILED
+#if defined(SIMPLELOG_SHARED) && (defined(__GNUC__) || defined(__clang__))
+#define SIMPLELOG_API __attribute__((visibility("default")))
+#else
+#define SIMPLELOG_API
+#endif // SIMPLELOG_SHARED
+#else
+#define SIMPLELOG_API inline
+#endif // SIMPLELOG_COMPILED
+
+// The state of the logger lives in inline functions, which a shared backend and the application have to share instead of keeping a copy each
+#if defined(SIMPLELOG_SHARED) && (defined(__GNUC__) || defined(__clang__))
+#define SIMPLELOG_VISIBILITY_BEGIN _Pragma("GCC visibility push(default)")
+#define SIMPLELOG_VISIBILITY_END _Pragma("GCC visibility pop")
+#else
+#define SIMPLELOG_VISIBILITY_BEGIN
+#define SIMPLELOG_VISIBILITY_END
+#endif // SIMPLELOG_SHARED
+
+/**
+* @brief The front-end of SimpleLog: the logging macros and everything they need to capture a call.
+*
+* Formatting, the outputs and the configuration are declared here and defined in SimpleLog.ipp, which this header includes unless `SIMPLELOG_COMPILED` is defined.
+* With `SIMPLELOG_COMPILED` the backend is compiled once from SimpleLog.cpp instead and only translation units that configure the logger include SimpleLog.ipp.
+*
+* @author Narumikazuchi
+* @date 16.10.2026
+*/
+SIMPLELOG_VISIBILITY_BEGIN
+namespace SimpleLog
+{
+	/**
+	* @brief Represents known string-like types.
+	* @author Narumikazuchi
+	* @date 06.05.2025
+	*/
+	template <typename TString>
+	concept _StringLike =
+		std::is_base_of_v<std::string, std::remove_cvref_t<TString>>
+		|| std::is_base_of_v<std::string_view, std::remove_cvref_t<TString>>
+		|| std::is_same_v<char*, std::remove_cvref_t<TString>>
+		|| std::is_same_v<char* const, std::remove_cvref_t<TString>>
+		|| std::is_same_v<const char*, std::remove_cvref_t<TString>>
+		|| std::is_same_v<const char* const, std::remove_cvref_t<TString>>;
+
+	/**
+	* @brief Represents string-convertible types.
+	* @author Narumikazuchi
+	* @date 06.05.2025
+	*/
+	template <typename TString>
+	concept _StringConvertible =
+		std::is_convertible_v<std::remove_cvref_t<TString>, std::string>
+		|| std::is_convertible_v<std::remove_cvref_t<TString>, std::string_view>
+		|| std::is_convertible_v<std::remove_cvref_t<TString>, char*>
+		|| std::is_convertible_v<std::remove_cvref_t<TString>, char* const>
+		|| std::is_convertible_v<std::remove_cvref_t<TString>, const char*>
+		|| std::is_convertible_v<std::remove_cvref_t<TString>, const char* const>;
+
+	/**
+	* @brief Helper to check if a type is castable to another.
+	* @author Narumikazuchi
+	* @date 25.07.2025
+	*/
+	template <typename TFrom, typename TTo>
+	concept _Castable = requires (
+		TFrom from
+	) {
+		{ static_cast<TTo>(from) } -> std::same_as<TTo>;
+	};
+
+	/**
+	* @brief Represents string-castable types.
+	* @author Narumikazuchi
+	* @date 25.07.2025
+	*/
+	template <typename TValue>
+	concept _StringCastable = 
+		_Castable<TValue, std::string>
+		|| _Castable<TValue, const std::string>
+		|| _Castable<TValue, std::string_view>
+		|| _Castable<TValue, const std::string_view>
+		|| _Castable<TValue, char*>
+		|| _Castable<TValue, const char*>
+		|| _Castable<TValue, char* const>
+		|| _Castable<TValue, const char* const>;
+
+	/**
+	* @brief Represents string-appendable types.
+	* @author Narumikazuchi
+	* @date 06.05.2025
+	*/
+	template <typename TValue>
+	concept _StringAppendable = requires(
+		std::string string,
+		TValue value
+	) {
+		{ string += value };
+	};
+
+	/**
+	* @brief Represents stringifyable types.
+	* @author Narumikazuchi
+	* @date 06.05.2025
+	*/
+	template <typename TValue>
+	concept _StdStringify = requires(
+		TValue value
+	) {
+		{ std::to_string(value) } -> std::same_as<std::string>;
+	};
+
+	/**
+	* @brief Represents stringifyable types.
+	* @author Narumikazuchi
+	* @date 06.05.2025
+	*/
+	template <typename TValue>
+	concept _Stringify =
+		requires(TValue value) { { value.ToString() } -> std::same_as<std::string>; }
+		|| requires(TValue value) { { value.ToString() } -> std::same_as<const std::string&>; }
+		|| requires(TValue value) { { value.ToString() } -> std::same_as<std::string_view>; }
+		|| requires(TValue value) { { value.ToString() } -> std::same_as<const std::string_view&>; }
+		|| requires(TValue value) { { value.ToString() } -> std::same_as<char*>; }
+		|| requires(TValue value) { { value.ToString() } -> std::same_as<char* const>; }
+		|| requires(TValue value) { { value.ToString() } -> std::same_as<const char*>; }
+		|| requires(TValue value) { { value.ToString() } -> std::same_as<const char* const>; };
+
+	/**
+	* @brief Represents named fields created with `Field`.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <typename TValue>
+	concept _FieldLike = requires {
+		requires std::remove_cvref_t<TValue>::IsField == true;
+	};
+
+	/**
+	* @brief Represents loggable types.
+	* @author Narumikazuchi
+	* @date 06.05.2025
+	*/
+	template <typename TValue>
+	concept _Loggable =
+		_StringLike<TValue>
+		|| _StringConvertible<TValue>
+		|| _StringAppendable<TValue>
+		|| _StdStringify<TValue>
+		|| _Stringify<TValue>
+		|| _FieldLike<TValue>;
+
+	/**
+	* @brief A named value for structured logging. The name is used as the key of the value in structured output (like JSON).
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <typename TValue>
+	struct Field final
+	{
+	public:
+		static constexpr bool IsField = true;
+
+		constexpr Field(
+			std::string_view name,
+			const TValue& value
+		) : Name(name),
+			Value(value)
+		{ };
+
+		~Field() = default;
+
+		std::string_view Name;
+		const TValue& Value;
+	};
+
+	template <typename TValue>
+	Field(std::string_view, const TValue&) -> Field<TValue>;
+
+	/**
+	* @brief Represents a string literal for template parameters.
+	* @author Narumikazuchi
+	* @date 06.05.2025
+	*/
+	template <size_t NSize>
+	struct StringLiteral final
+	{
+	public:
+		constexpr StringLiteral(
+			const char (&value)[NSize]
+		) : Value()
+		{
+			size_t index = 0ULL;
+			while (index < NSize)
+			{
+				this->Value[index] = value[index];
+				index += 1ULL;
+			}
+		};
+
+		~StringLiteral() = default;
+
+		char Value[NSize];
+	};
+
+	/**
+	* @brief A single piece of a message template: a run of text or a placeholder.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _TemplateToken final
+	{
+	public:
+		enum class Kind : uint8_t
+		{
+			End			= 0,	///< The template has no more tokens.
+			Text		= 1,	///< Text that is copied verbatim.
+			Placeholder	= 2,	///< A placeholder, the range is its (possibly empty) name.
+		};
+
+		constexpr _TemplateToken() = default;
+
+		constexpr _TemplateToken(
+			Kind type,
+			size_t begin,
+			size_t length
+		) : Type(type),
+			Begin(begin),
+			Length(length)
+		{ };
+
+		Kind Type = Kind::End;
+		size_t Begin = 0ULL;
+		size_t Length = 0ULL;
+	};
+
+	/**
+	* @brief Reads the next token of a message template.
+	*
+	* `{}` and `{name}` are placeholders, `{{` and `}}` are escaped braces and any other brace is dropped. Runs of text are returned as a whole, so they can be copied in bulk.
+	*
+	* @param text The template.
+	* @param position The position to continue from. Will be advanced past the token.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	constexpr _TemplateToken _NextTemplateToken(
+		std::string_view text,
+		size_t& position
+	) {
+		while (position < text.size())
+		{
+			char character = text[position];
+			if (character == '{'
+				|| character == '}')
+			{
+				if (position + 1ULL < text.size()
+					&& text[position + 1ULL] == character)
+				{
+					position += 2ULL;
+					return _TemplateToken(_TemplateToken::Kind::Text, position - 2ULL, 1ULL);
+				}
+
+				if (character == '{')
+				{
+					size_t end = position + 1ULL;
+					while (end < text.size()
+						   && ((text[end] >= 'a' && text[end] <= 'z')
+							   || (text[end] >= 'A' && text[end] <= 'Z')
+							   || (text[end] >= '0' && text[end] <= '9')
+							   || text[end] == '_'
+							   || text[end] == '.'))
+					{
+						end += 1ULL;
+					}
+
+					if (end < text.size()
+						&& text[end] == '}')
+					{
+						_TemplateToken token = _TemplateToken(_TemplateToken::Kind::Placeholder, position + 1ULL, end - position - 1ULL);
+						position = end + 1ULL;
+						return token;
+					}
+				}
+
+				position += 1ULL;
+				continue;
+			}
+
+			size_t end = position;
+			while (end < text.size()
+				   && text[end] != '{'
+				   && text[end] != '}')
+			{
+				end += 1ULL;
+			}
+
+			_TemplateToken token = _TemplateToken(_TemplateToken::Kind::Text, position, end - position);
+			position = end;
+			return token;
+		}
+
+		return _TemplateToken();
+	}
+
+	/**
+	* @brief Counts and checks whether the number of placeholders in the SValue literal matches the number of TArguments.
+	* @author Narumikazuchi
+	* @date 06.05.2025
+	*/
+	template <StringLiteral SValue, typename... TArguments>
+	constexpr bool PlaceholderCountMatchesArgumentCount()
+	{
+		constexpr std::string_view text = std::string_view(SValue.Value, sizeof(SValue.Value) - 1ULL);
+		size_t position = 0ULL;
+		size_t count = 0ULL;
+
+		_TemplateToken token = _NextTemplateToken(
+			text,
+			position
+		);
+		while (token.Type != _TemplateToken::Kind::End)
+		{
+			if (token.Type == _TemplateToken::Kind::Placeholder)
+			{
+				count += 1ULL;
+			}
+
+			token = _NextTemplateToken(
+				text,
+				position
+			);
+		}
+
+		return count == sizeof...(TArguments);
+	}
+
+	/**
+	* @brief Enumeration representing different log levels.
+	* @author Narumikazuchi
+	* @date 06.05.2025
+	*/
+	enum class LogSeverity : uint8_t
+	{
+		Disabled	= 0,	///< Logging is disabled.
+		Critical	= 1,	///< Critical errors that will crash the application.
+		Error		= 2,	///< Errors that keep a feature from functioning, but do not crash the entire application.
+		Warning		= 3,	///< Warnings that indicate potential problems.
+		Information	= 4,	///< Informational messages to provide context or status updates.
+		Debug		= 5,	///< Detailed debugging information (only used during development).
+		Trace		= 6,	///< Information detailing the order of events in the entire application.
+	};
+
+	/**
+	* @brief A wrapper class for working with log levels as values and providing utility functions.
+	* @author Narumikazuchi
+	* @date 06.05.2025
+	*/
+	struct LogLevel final
+	{
+	public:
+		/**
+		* @brief Parse a string representation of a log level into a `LogLevel` object.
+		* @param value The string to parse (case-insensitive).
+		* @return A `LogLevel` object representing the parsed log level, or `LogLevels::Disabled` if parsing fails.
+		* @author Narumikazuchi
+		* @date 20.06.2025
+		*/
+		static inline LogLevel Parse(
+			const std::string& value
+		) {
+			std::string_view view = value;
+			return LogLevel::Parse(
+				view
+			);
+		};
+		/**
+		* @brief Parse a string representation of a log level into a `LogLevel` object.
+		* @param value The string to parse (case-insensitive).
+		* @return A `LogLevel` object representing the parsed log level, or `LogLevels::Disabled` if parsing fails.
+		* @author Narumikazuchi
+		* @date 20.06.2025
+		*/
+		static inline LogLevel Parse(
+			std::string_view value
+		) {
+			std::string lowered = std::string();
+			lowered.reserve(
+				value.size()
+			);
+			for (char character : value)
+			{
+				lowered.push_back(
+					std::tolower(
+						character
+					)
+				);
+			}
+
+			static const std::string trace = std::string("trace");
+			static const std::string debug = std::string("debug");
+			static const std::string info = std::string("info");
+			static const std::string information = std::string("information");
+			static const std::string warn = std::string("warn");
+			static const std::string warning = std::string("warning");
+			static const std::string error = std::string("error");
+			static const std::string critical = std::string("critical");
+			if (lowered == trace)
+			{
+				return LogLevel(
+					LogSeverity::Trace
+				);
+			}
+			else if (lowered == debug)
+			{
+				return LogLevel(
+					LogSeverity::Debug
+				);
+			}
+			else if (lowered == information
+					|| lowered == info)
+			{
+				return LogLevel(
+					LogSeverity::Information
+				);
+			}
+			else if (lowered == warning
+					|| lowered == warn)
+			{
+				return LogLevel(
+					LogSeverity::Warning
+				);
+			}
+			else if (lowered == error)
+			{
+				return LogLevel(
+					LogSeverity::Error
+				);
+			}
+			else if (lowered == critical)
+			{
+				return LogLevel(
+					LogSeverity::Critical
+				);
+			}
+			else
+			{
+				return LogLevel(
+					LogSeverity::Disabled
+				);
+			}
+		};
+
+		constexpr LogLevel() :
+			m_Value(LogSeverity::Disabled)
+		{ };
+
+		constexpr LogLevel(
+			LogSeverity value
+		) : m_Value(value)
+		{ };
+
+		~LogLevel() = default;
+
+		constexpr operator LogSeverity() const
+		{
+			return m_Value;
+		}
+
+		constexpr bool operator<(
+			LogLevel other
+		) const {
+			return static_cast<uint8_t>(m_Value) < static_cast<uint8_t>(other.m_Value);
+		};
+
+		constexpr bool operator>(
+			LogLevel other
+		) const {
+			return static_cast<uint8_t>(m_Value) > static_cast<uint8_t>(other.m_Value);
+		};
+
+		constexpr bool operator<=(
+			LogLevel other
+		) const {
+			return static_cast<uint8_t>(m_Value) <= static_cast<uint8_t>(other.m_Value);
+		};
+
+		constexpr bool operator>=(
+			LogLevel other
+		) const {
+			return static_cast<uint8_t>(m_Value) >= static_cast<uint8_t>(other.m_Value);
+		};
+
+		constexpr bool operator==(
+			LogLevel other
+		) const {
+			return static_cast<uint8_t>(m_Value) == static_cast<uint8_t>(other.m_Value);
+		};
+
+		constexpr bool operator!=(
+			LogLevel other
+		) const {
+			return static_cast<uint8_t>(m_Value) != static_cast<uint8_t>(other.m_Value);
+		};
+
+		/**
+		* @brief Parse this instance to it's string representation.
+		* @return The value of this instance represented as a string.
+		* @author Narumikazuchi
+		* @date 13.01.2025
+		*/
+		inline const std::string& ToString() const
+		{
+			static const std::string trace = std::string("Trace");
+			static const std::string debug = std::string("Debug");
+			static const std::string information = std::string("Information");
+			static const std::string warning = std::string("Warning");
+			static const std::string error = std::string("Error");
+			static const std::string critical = std::string("Critical");
+			static const std::string unknown = std::string("Unknown");
+			switch (m_Value)
+			{
+				case LogSeverity::Trace:
+				{
+					return trace;
+				}
+				case LogSeverity::Debug:
+				{
+					return debug;
+				}
+				case LogSeverity::Information:
+				{
+					return information;
+				}
+				case LogSeverity::Warning:
+				{
+					return warning;
+				}
+				case LogSeverity::Error:
+				{
+					return error;
+				}
+				case LogSeverity::Critical:
+				{
+					return critical;
+				}
+				default:
+				{
+					return unknown;
+				}
+			}
+		};
+
+	private:
+		LogSeverity m_Value;
+	};
+
+	namespace LogLevels
+	{
+		/**
+		* @brief Logging is disabled.
+		*/
+		inline constexpr LogLevel Disabled = LogLevel(LogSeverity::Disabled);
+		/**
+		* @brief Critical errors that will crash the application.
+		*/
+		inline constexpr LogLevel Critical = LogLevel(LogSeverity::Critical);
+		/**
+		* @brief Errors that keep a feature from functioning, but do not crash the entire application.
+		*/
+		inline constexpr LogLevel Error = LogLevel(LogSeverity::Error);
+		/**
+		* @brief Warnings that indicate potential problems.
+		*/
+		inline constexpr LogLevel Warning = LogLevel(LogSeverity::Warning);
+		/**
+		* @brief Informational messages to provide context or status updates.
+		*/
+		inline constexpr LogLevel Information = LogLevel(LogSeverity::Information);
+		/**
+		* @brief Detailed debugging information (only used during development).
+		*/
+		inline constexpr LogLevel Debug = LogLevel(LogSeverity::Debug);
+		/**
+		* @brief Information detailing the order of events in the entire application.
+		*/
+		inline constexpr LogLevel Trace = LogLevel(LogSeverity::Trace);
+	}
+
+	struct _JsonSkeleton;
+
+	/**
+	* @brief The outputs a category writes to. Combine them with `|`.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	namespace CategorySinks
+	{
+		inline constexpr uint8_t None = 0x00U;
+		inline constexpr uint8_t Console = 0x01U;
+		inline constexpr uint8_t File = 0x02U;
+		inline constexpr uint8_t JsonFile = 0x04U;
+		inline constexpr uint8_t All = 0x07U;
+	}
+
+	/**
+	* @brief Overrides the level check for a single call site at runtime.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	enum class CallSiteState : uint8_t
+	{
+		Default		= 0,	///< The call site writes according to the configured levels.
+		Enabled		= 1,	///< The call site always writes, whatever the configured levels are.
+		Disabled	= 2,	///< The call site never writes.
+	};
+
+	struct CallSite;
+
+	/**
+	* @brief Helper for the call site registry. The most recently registered call site; every call site links to the one registered before it. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline std::atomic<const CallSite*>& _LastCallSite()
+	{
+		static std::atomic<const CallSite*> last = nullptr;
+
+		return last;
+	}
+
+	/**
+	* @brief The static description of a single logging call site. The logging macros create one per expansion, so everything derived from it only has to be computed once.
+	*
+	* A call site registers itself when it is created, which for the macros is the first time the call site is reached.
+	*
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct CallSite final
+	{
+	public:
+		CallSite(
+			LogLevel level,
+			std::string_view module,
+			std::string_view line,
+			std::string_view function,
+			std::string_view text,
+			size_t category = 0ULL
+		) : Level(level),
+			Module(module),
+			Line(line),
+			Function(function),
+			Template(text),
+			Category(category)
+		{
+			this->Previous = _LastCallSite().load(
+				std::memory_order_relaxed
+			);
+			while (_LastCallSite().compare_exchange_weak(this->Previous, this, std::memory_order_release, std::memory_order_relaxed) == false)
+			{ }
+		};
+
+		CallSite(const CallSite&) = delete;
+		CallSite& operator=(const CallSite&) = delete;
+
+		~CallSite() = default;
+
+		LogLevel Level;
+		std::string_view Module;
+		std::string_view Line;
+		std::string_view Function;
+		std::string_view Template;
+		size_t Category;								///< The index of the category (`RegisterCategory`).
+		mutable std::atomic<const _JsonSkeleton*> Json = nullptr;
+		mutable std::atomic<uint64_t> Filter = 0ULL;	///< The most detailed level the call site writes (`_CallSiteCapture` if every message has to be looked at), tagged with the generation of the settings.
+		mutable std::atomic<CallSiteState> State = CallSiteState::Default;
+		mutable std::atomic<uint64_t> Hits = 0ULL;		///< How many messages of the call site passed the level check.
+		mutable std::atomic<uint64_t> Bytes = 0ULL;		///< The bytes written by the call site (only with `ProfileCallSites`).
+		mutable std::atomic<uint64_t> Nanoseconds = 0ULL;	///< The time spent writing the records of the call site (only with `ProfileCallSites`).
+		const CallSite* Previous = nullptr;				///< The call site registered before this one.
+	};
+
+	/**
+	* @brief Hashes the name of a category (FNV-1a). The logging macros hash the name at compile time.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	constexpr uint64_t HashCategory(
+		std::string_view name
+	) {
+		uint64_t hash = 0xCBF29CE484222325ULL;
+		for (char character : name)
+		{
+			hash ^= static_cast<uint8_t>(character);
+			hash *= 0x100000001B3ULL;
+		}
+
+		return hash;
+	}
+
+	/**
+	* @brief Registers a category (and its parents) if it does not exist yet. The logging macros call this once per call site.
+	* @param name The name of the category; a '.' separates it from its parent (e.g. "net.http").
+	* @param hash The hash of the name (`HashCategory`).
+	* @return The index of the category.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API size_t RegisterCategory(
+		std::string_view name,
+		uint64_t hash
+	);
+
+	/**
+	* @brief Layout of a single binary record, as it is stored by the flight recorder and the backtrace ring. The strings and the encoded arguments follow directly after it.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _BinaryRecordHeader final
+	{
+	public:
+		static constexpr uint32_t ExpectedMagic = 0x52464C53U; // "SLFR"
+
+		uint32_t Magic;
+		uint32_t Size;
+		int64_t Time;
+		const CallSite* Site;		///< Only valid inside the process that wrote the record.
+		uint8_t Level;
+		uint8_t ArgumentCount;
+		uint8_t Category;
+		uint16_t ModuleLength;
+		uint16_t LineLength;
+		uint16_t FunctionLength;
+		uint16_t TemplateLength;
+		uint16_t ThreadLength;
+		uint32_t ArgumentsLength;
+	};
+
+	/**
+	* @brief Binary representation of logging arguments. Formatting them into text can be deferred until the record is actually read.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _EncodedArguments final
+	{
+	public:
+		static constexpr char SignedTag = 'i';
+		static constexpr char UnsignedTag = 'u';
+		static constexpr char FloatingTag = 'f';
+		static constexpr char StringTag = 's';
+		static constexpr char NameTag = 'k';
+
+		char* Data = nullptr;
+		size_t Capacity = 0ULL;
+		size_t Size = 0ULL;
+		size_t Count = 0ULL;
+
+		/**
+		* @brief Appends a tagged fixed-size value. Returns false if the buffer is full.
+		*/
+		template <typename TValue>
+		inline bool AppendValue(
+			char tag,
+			TValue value
+		) {
+			if (this->Size + 1ULL + sizeof(TValue) > this->Capacity)
+			{
+				return false;
+			}
+
+			this->Data[this->Size] = tag;
+			std::memcpy(
+				this->Data + this->Size + 1ULL,
+				&value,
+				sizeof(TValue)
+			);
+			this->Size += 1ULL + sizeof(TValue);
+			this->Count += 1ULL;
+			return true;
+		};
+
+		/**
+		* @brief Appends a string, truncating it to the remaining space. Returns false if the buffer is full.
+		*/
+		inline bool AppendString(
+			std::string_view value
+		) {
+			if (this->Size + 1ULL + sizeof(uint32_t) > this->Capacity)
+			{
+				return false;
+			}
+
+			uint32_t length = static_cast<uint32_t>(std::min<size_t>(
+				value.size(),
+				this->Capacity - this->Size - 1ULL - sizeof(uint32_t)
+			));
+			this->Data[this->Size] = StringTag;
+			std::memcpy(
+				this->Data + this->Size + 1ULL,
+				&length,
+				sizeof(uint32_t)
+			);
+			std::memcpy(
+				this->Data + this->Size + 1ULL + sizeof(uint32_t),
+				value.data(),
+				length
+			);
+			this->Size += 1ULL + sizeof(uint32_t) + length;
+			this->Count += 1ULL;
+			return true;
+		};
+
+		/**
+		* @brief Appends the name of the following argument. Names are not counted as arguments. Returns false if the buffer is full.
+		*/
+		inline bool AppendName(
+			std::string_view name
+		) {
+			size_t length = std::min<size_t>(
+				name.size(),
+				255ULL
+			);
+			if (this->Size + 2ULL + length > this->Capacity)
+			{
+				return false;
+			}
+
+			this->Data[this->Size] = NameTag;
+			this->Data[this->Size + 1ULL] = static_cast<char>(static_cast<uint8_t>(length));
+			std::memcpy(
+				this->Data + this->Size + 2ULL,
+				name.data(),
+				length
+			);
+			this->Size += 2ULL + length;
+			return true;
+		};
+	};
+
+	/**
+	* @brief Helper function for logging. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 06.05.2025
+	*/
+	template <size_t NSize, typename TArgument>
+	inline void UnrollArgument(
+		std::array<std::string, NSize>& strings,
+		size_t index,
+		TArgument&& argument
+	) {
+		if constexpr (_FieldLike<std::remove_reference_t<decltype(argument)>> == true)
+		{
+			UnrollArgument(
+				strings,
+				index,
+				argument.Value
+			);
+		}
+		else if constexpr (_StringLike<std::remove_reference_t<decltype(argument)>> == true)
+		{
+			if constexpr (std::is_same_v<std::string, decltype(argument)> == true
+						  || std::is_same_v<std::string&, decltype(argument)> == true
+						  || std::is_same_v<const std::string&, decltype(argument)> == true)
+			{
+				strings[index] = argument;
+			}
+			else
+			{
+				// Assigning keeps the capacity of the string
+				strings[index].assign(
+					std::string_view(argument)
+				);
+			}
+		}
+		else if constexpr (_StringConvertible<std::remove_reference_t<decltype(argument)>> == true)
+		{
+			if constexpr (std::is_convertible_v<std::remove_cvref_t<decltype(argument)>, std::string_view> == true)
+			{
+				strings[index].assign(
+					static_cast<std::string_view>(argument)
+				);
+			}
+			else
+			{
+				strings[index] = std::string(
+					argument
+				);
+			}
+		}
+		else if constexpr (_StringCastable<std::remove_reference_t<decltype(argument)>> == true)
+		{
+			strings[index] = static_cast<std::string>(argument);
+		}
+		else if constexpr (_StdStringify<std::remove_reference_t<decltype(argument)>> == true)
+		{
+			strings[index] = std::to_string(
+				argument
+			);
+		}
+		else if constexpr (_Stringify<std::remove_reference_t<decltype(argument)>> == true)
+		{
+			auto& value = argument.ToString();
+			if constexpr (std::is_same_v<std::string, decltype(value)> == true
+						  || std::is_same_v<std::string&, decltype(value)> == true
+						  || std::is_same_v<const std::string&, decltype(value)> == true)
+			{
+				strings[index] = value;
+			}
+			else
+			{
+				strings[index].assign(
+					std::string_view(value)
+				);
+			}
+		}
+		else if constexpr (_StringAppendable<std::remove_reference_t<decltype(argument)>> == true)
+		{
+			strings[index].clear();
+			strings[index] += argument;
+		}
+	};
+
+	/**
+	* @brief Helper function for logging. The argument strings of every call of the calling thread that is currently formatting. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <size_t NSize>
+	struct _ArgumentStack final
+	{
+	public:
+		std::deque<std::array<std::string, NSize>> Frames = std::deque<std::array<std::string, NSize>>();
+		size_t Depth = 0ULL;
+	};
+
+	/**
+	* @brief Helper function for logging. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <size_t NSize>
+	inline _ArgumentStack<NSize>& _CurrentArgumentStack()
+	{
+		thread_local _ArgumentStack<NSize> stack = _ArgumentStack<NSize>();
+
+		return stack;
+	}
+
+	/**
+	* @brief Helper function for logging. Borrows argument strings from the calling thread for the duration of a call. The strings keep their capacity, so formatting does not allocate once a thread has logged its longest arguments. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <size_t NSize>
+	struct _ArgumentFrame final
+	{
+	public:
+		_ArgumentFrame()
+			: m_Stack(_CurrentArgumentStack<NSize>()),
+			  Strings(_Borrow(m_Stack))
+		{ };
+
+		_ArgumentFrame(const _ArgumentFrame&) = delete;
+		_ArgumentFrame& operator=(const _ArgumentFrame&) = delete;
+
+		~_ArgumentFrame()
+		{
+			m_Stack.Depth -= 1ULL;
+		};
+
+	private:
+		_ArgumentStack<NSize>& m_Stack;
+
+		// A call that logs while its arguments are formatted gets a frame of its own; the frames of a deque never move
+		static inline std::array<std::string, NSize>& _Borrow(
+			_ArgumentStack<NSize>& stack
+		) {
+			if (stack.Depth == stack.Frames.size())
+			{
+				stack.Frames.emplace_back();
+			}
+
+			stack.Depth += 1ULL;
+			return stack.Frames[stack.Depth - 1ULL];
+		};
+
+	public:
+		std::array<std::string, NSize>& Strings;
+	};
+
+	/**
+	* @brief Helper function for logging. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 06.05.2025
+	*/
+	template <size_t NSize, typename TTuple, size_t... NIndecies>
+	inline void UnrollArguments(
+		std::array<std::string, NSize>& strings,
+		TTuple&& tuple,
+		std::index_sequence<NIndecies...>
+	) {
+		(UnrollArgument(
+			strings,
+			NIndecies,
+			std::get<NIndecies>(tuple)
+		),
+		...);
+	};
+
+	/**
+	* @brief Helper function for logging. Gets the name given with `Field` and whether the argument is written as a number. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <typename TArgument>
+	inline void DescribeArgument(
+		std::string_view& name,
+		bool& numeric,
+		const TArgument& argument
+	) {
+		if constexpr (_FieldLike<TArgument> == true)
+		{
+			name = argument.Name;
+			DescribeArgument(
+				name,
+				numeric,
+				argument.Value
+			);
+		}
+		else
+		{
+			numeric = _StringConvertible<TArgument> == false
+					  && _StringCastable<TArgument> == false
+					  && _StdStringify<TArgument> == true
+					  && std::is_arithmetic_v<std::remove_cv_t<TArgument>> == true;
+		}
+	};
+
+	/**
+	* @brief Helper function for logging. Encodes an argument the same way `UnrollArgument` would turn it into text. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <typename TArgument>
+	inline bool EncodeArgument(
+		_EncodedArguments& encoded,
+		TArgument&& argument
+	) {
+		using TValue = std::remove_reference_t<decltype(argument)>;
+		if constexpr (_FieldLike<TValue> == true)
+		{
+			return encoded.AppendName(argument.Name)
+				   && EncodeArgument(
+					   encoded,
+					   argument.Value
+				   );
+		}
+		else if constexpr (_StringLike<TValue> == true)
+		{
+			return encoded.AppendString(
+				std::string_view(argument)
+			);
+		}
+		else if constexpr (_StringConvertible<TValue> == false
+						   && _StringCastable<TValue> == false
+						   && _StdStringify<TValue> == true
+						   && std::is_integral_v<std::remove_cv_t<TValue>> == true
+						   && std::is_signed_v<std::remove_cv_t<TValue>> == true)
+		{
+			return encoded.AppendValue(
+				_EncodedArguments::SignedTag,
+				static_cast<long long>(argument)
+			);
+		}
+		else if constexpr (_StringConvertible<TValue> == false
+						   && _StringCastable<TValue> == false
+						   && _StdStringify<TValue> == true
+						   && std::is_integral_v<std::remove_cv_t<TValue>> == true)
+		{
+			return encoded.AppendValue(
+				_EncodedArguments::UnsignedTag,
+				static_cast<unsigned long long>(argument)
+			);
+		}
+		else if constexpr (_StringConvertible<TValue> == false
+						   && _StringCastable<TValue> == false
+						   && _StdStringify<TValue> == true
+						   && (std::is_same_v<std::remove_cv_t<TValue>, float> == true
+							   || std::is_same_v<std::remove_cv_t<TValue>, double> == true))
+		{
+			return encoded.AppendValue(
+				_EncodedArguments::FloatingTag,
+				static_cast<double>(argument)
+			);
+		}
+		else
+		{
+			std::array<std::string, 1ULL> strings = { };
+			UnrollArgument(
+				strings,
+				0ULL,
+				std::forward<TArgument>(argument)
+			);
+			return encoded.AppendString(
+				strings[0]
+			);
+		}
+	};
+
+	/**
+	* @brief Helper function for logging. Encodes all arguments until the buffer is full. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <typename... TArguments>
+	inline void EncodeArguments(
+		_EncodedArguments& encoded,
+		TArguments&&... arguments
+	) {
+		static_cast<void>((EncodeArgument(
+			encoded,
+			std::forward<TArguments>(arguments)
+		)
+		&& ...));
+	};
+
+	struct _FlightRecorder;
+	struct _BacktraceRing;
+	struct _ScopeState;
+
+	/**
+	* @brief Helper for filters. The generation of the settings; it changes whenever anything that decides the level of a call site changes, which makes every cached decision stale. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline std::atomic<uint64_t>& _SettingsGeneration()
+	{
+		static std::atomic<uint64_t> generation = 1ULL;
+
+		return generation;
+	}
+
+	/**
+	* @brief Helper for scoped logging. How many scopes are active on the calling thread. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline size_t& _ScopeDepth()
+	{
+		thread_local size_t depth = 0ULL;
+
+		return depth;
+	}
+
+	/**
+	* @brief Helper for filters. Set in the cached decision of a call site while the flight recorder or the backtrace keeps messages that are not written. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	constexpr uint64_t _CallSiteCapture = 0x80ULL;
+
+	/**
+	* @brief Helper function for logging. Whether the cached decision of a call site discards a message, so the call can return without calling into the logger. Standalone use not supported.
+	*
+	* A decision is only used in the generation it was made in and never inside a scope, which buffers messages the level would discard.
+	*
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline bool _Discards(
+		const CallSite& site,
+		const LogLevel level
+	) {
+		const uint64_t cached = site.Filter.load(
+			std::memory_order_relaxed
+		);
+		return (cached >> 8U) == _SettingsGeneration().load(std::memory_order_relaxed)
+			   && static_cast<uint64_t>(static_cast<LogSeverity>(level)) > (cached & 0xFFULL)
+			   && _ScopeDepth() == 0ULL;
+	};
+
+	/**
+	* @brief Helper for filters. Resolves the level of a call site whose cached decision is stale. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API LogLevel _ResolveCallSite(
+		const CallSite& site
+	);
+
+	/**
+	* @brief Helper for filters. The most detailed level a call site writes; only calls into the logger if the cached decision is stale. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline LogLevel _CallSiteSeverity(
+		const CallSite& site
+	) {
+		const uint64_t cached = site.Filter.load(
+			std::memory_order_relaxed
+		);
+		if ((cached >> 8U) == _SettingsGeneration().load(std::memory_order_relaxed))
+		{
+			return LogLevel(static_cast<LogSeverity>(cached & (_CallSiteCapture - 1ULL)));
+		}
+
+		return _ResolveCallSite(
+			site
+		);
+	};
+
+	/**
+	* @brief Helper function for logging. What a logging call has to do once the call site, the scope and the severity have been checked. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _LogRoute final
+	{
+	public:
+		static constexpr size_t MaximumCaptureSize = 8192ULL;
+
+		_FlightRecorder* Recorder = nullptr;
+		_BacktraceRing* Backtrace = nullptr;
+		size_t CaptureSize = 0ULL;			///< The largest record the flight recorder or the backtrace takes.
+		_ScopeState* Scope = nullptr;		///< Set if the record is buffered in a scope instead of written.
+		size_t Category = 0ULL;
+		bool Write = false;					///< Set if the record is formatted and written to the outputs.
+		int64_t Start = 0LL;				///< When the call was accepted, in ticks of the steady clock.
+
+		inline bool Enabled() const
+		{
+			return this->Recorder != nullptr
+				   || this->Backtrace != nullptr
+				   || this->Scope != nullptr
+				   || this->Write == true;
+		};
+	};
+
+	/**
+	* @brief Helper function for logging. Decides what a logging call has to do and counts the calls that do nothing; calls that the cached decision of their call site discards never get here (see `_Discards`). Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API _LogRoute _RouteLog(
+		const CallSite* site,
+		const LogLevel level,
+		std::string_view module,
+		std::string_view function
+	);
+
+	/**
+	* @brief Helper function for logging. Writes a message whose arguments are already formatted to all outputs. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API void _WriteFormatted(
+		const _LogRoute& route,
+		const CallSite* site,
+		const LogLevel level,
+		std::string_view module,
+		std::string_view line,
+		std::string_view function,
+		std::string_view messageTemplate,
+		const std::string* arguments,
+		const std::string_view* names,
+		const bool* numeric,
+		size_t argumentCount
+	);
+
+	/**
+	* @brief Helper function for logging. Writes the location and the template of a binary record into the buffer. Standalone use not supported.
+	* @return The offset at which the encoded arguments start.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API size_t _EncodeRecordLocation(
+		_BinaryRecordHeader& header,
+		char* record,
+		size_t capacity,
+		const LogLevel level,
+		std::string_view module,
+		std::string_view line,
+		std::string_view function,
+		std::string_view messageTemplate
+	);
+
+	/**
+	* @brief Helper function for logging. Completes a binary record once its arguments are encoded. Standalone use not supported.
+	* @return The size of the record rounded up to a multiple of 8 bytes or zero if it does not fit.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API size_t _FinishRecord(
+		_BinaryRecordHeader& header,
+		char* record,
+		size_t capacity,
+		size_t offset,
+		const _EncodedArguments& encoded
+	);
+
+	/**
+	* @brief Helper function for logging. Copies a binary record into the flight recorder and the backtrace ring of the route. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API void _StoreRecord(
+		const _LogRoute& route,
+		const char* record,
+		size_t size
+	);
+
+	/**
+	* @brief Helper for scoped logging. Makes room for a record in the arena of the calling thread. Standalone use not supported.
+	* @param capacity Receives how many bytes the record may use.
+	* @return Where the record is encoded or nullptr if the scope is full and the record is dropped.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API char* _ReserveScoped(
+		_ScopeState& state,
+		const LogLevel level,
+		size_t& capacity
+	);
+
+	/**
+	* @brief Helper for scoped logging. Keeps a record encoded into the arena. An Error or Critical fails the scope and writes everything buffered so far. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API void _CommitScoped(
+		_ScopeState& state,
+		const LogLevel level,
+		size_t size
+	);
+
+	/**
+	* @brief Helper function for logging. Writes a complete binary record (header, location, template and encoded arguments) into the buffer. Standalone use not supported.
+	* @return The size of the record rounded up to a multiple of 8 bytes.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <typename... TArguments>
+	inline size_t _EncodeRecord(
+		char* record,
+		size_t capacity,
+		const _LogRoute& route,
+		const CallSite* site,
+		const LogLevel level,
+		std::string_view module,
+		std::string_view line,
+		std::string_view function,
+		std::string_view messageTemplate,
+		TArguments&&... arguments
+	) {
+		_BinaryRecordHeader header = _BinaryRecordHeader();
+		header.Site = site;
+		header.Category = static_cast<uint8_t>(route.Category);
+		size_t offset = _EncodeRecordLocation(
+			header,
+			record,
+			capacity,
+			level,
+			module,
+			line,
+			function,
+			messageTemplate
+		);
+		_EncodedArguments encoded = _EncodedArguments();
+		encoded.Data = record + offset;
+		encoded.Capacity = capacity - offset;
+		EncodeArguments(
+			encoded,
+			std::forward<TArguments>(arguments)...
+		);
+		return _FinishRecord(
+			header,
+			record,
+			capacity,
+			offset,
+			encoded
+		);
+	};
+
+	/**
+	* @brief Helper function for logging. Captures the arguments of an enabled call, which is the only part that depends on the argument types. Every call site with the same argument types shares it. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <typename... TArguments>
+	SIMPLELOG_COLD inline void _CaptureLog(
+		const _LogRoute& route,
+		const CallSite* site,
+		const LogLevel level,
+		std::string_view module,
+		std::string_view line,
+		std::string_view function,
+		std::string_view messageTemplate,
+		TArguments&&... arguments
+	) {
+		// The flight recorder keeps every record, the backtrace only the ones that are discarded because of the severity
+		if (route.Recorder != nullptr
+			|| route.Backtrace != nullptr)
+		{
+			alignas(8) char record[_LogRoute::MaximumCaptureSize];
+			size_t size = _EncodeRecord(
+				record,
+				route.CaptureSize,
+				route,
+				site,
+				level,
+				module,
+				line,
+				function,
+				messageTemplate,
+				arguments...
+			);
+			if (size > 0ULL)
+			{
+				_StoreRecord(
+					route,
+					record,
+					size
+				);
+			}
+		}
+
+		// Messages inside a scope are only written once the scope has ended or failed
+		if (route.Scope != nullptr)
+		{
+			size_t capacity = 0ULL;
+			char* record = _ReserveScoped(
+				*route.Scope,
+				level,
+				capacity
+			);
+			if (record != nullptr)
+			{
+				_CommitScoped(
+					*route.Scope,
+					level,
+					_EncodeRecord(
+						record,
+						capacity,
+						route,
+						site,
+						level,
+						module,
+						line,
+						function,
+						messageTemplate,
+						arguments...
+					)
+				);
+			}
+
+			return;
+		}
+
+		if (route.Write == false)
+		{
+			return;
+		}
+
+		// Format arguments
+		_ArgumentFrame<sizeof...(TArguments)> frame = _ArgumentFrame<sizeof...(TArguments)>();
+		std::array<std::string, sizeof...(TArguments)>& unrolledArguments = frame.Strings;
+		std::array<std::string_view, sizeof...(TArguments)> names = { };
+		std::array<bool, sizeof...(TArguments)> numeric = { };
+		UnrollArguments(
+			unrolledArguments,
+			std::forward_as_tuple(
+				arguments...
+			),
+			std::make_index_sequence<sizeof...(TArguments)>()
+		);
+		size_t index = 0ULL;
+		static_cast<void>(((DescribeArgument(
+			names[index],
+			numeric[index],
+			arguments
+		), index += 1ULL), ...));
+
+		_WriteFormatted(
+			route,
+			site,
+			level,
+			module,
+			line,
+			function,
+			messageTemplate,
+			unrolledArguments.data(),
+			names.data(),
+			numeric.data(),
+			sizeof...(TArguments)
+		);
+	};
+
+	/**
+	* @brief Helper function for logging. Writes a message to all outputs. Standalone use not supported.
+	*
+	* Only deciding whether the call does anything is part of the caller: a message the cached decision of its call site discards costs two loads and a comparison. Everything else is out of line.
+	*
+	* @param site The call site the message is written from, if any. It caches the static parts of the structured output.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <StringLiteral STemplate, typename... TArguments>
+	inline void _WriteLog(
+		const CallSite* site,
+		const LogLevel level,
+		std::string_view module,
+		std::string_view line,
+		std::string_view function,
+		TArguments&&... arguments
+	) {
+		if (site != nullptr
+			&& _Discards(*site, level) == true) [[likely]]
+		{
+			return;
+		}
+
+		const _LogRoute route = _RouteLog(
+			site,
+			level,
+			module,
+			function
+		);
+		if (route.Enabled() == true) [[unlikely]]
+		{
+			_CaptureLog(
+				route,
+				site,
+				level,
+				module,
+				line,
+				function,
+				std::string_view(STemplate.Value, sizeof(STemplate.Value) - 1ULL), // Exclude \0 character
+				std::forward<TArguments>(arguments)...
+			);
+		}
+	};
+
+	/**
+	* @brief Writes a message to the log file with variable arguments.
+	*
+	* This function writes a log message to the logger's output stream, which is usually a text file. The message includes the severity level, module name, function name, and a formatted string with optional arguments.
+	*
+	* @param level The LogLevel of the message.
+	* @param module The name of the module that generated the message.
+	* @param line The line number where in the module the log is happening.
+	* @param function The name of the function that generated the message.
+	* @param arguments The variable arguments to pass to the formatting function.
+	* @author Narumikazuchi
+	* @date 01.07.2025
+	*/
+	template <StringLiteral STemplate, _Loggable... TArguments>
+		requires (PlaceholderCountMatchesArgumentCount<STemplate, TArguments...>())
+	inline void WriteLog(
+		const LogLevel level,
+		const std::string& module,
+		const std::string& line,
+		const std::string& function,
+		TArguments&&... arguments
+	) {
+		_WriteLog<STemplate>(
+			nullptr,
+			level,
+			module,
+			line,
+			function,
+			std::forward<TArguments>(arguments)...
+		);
+	};
+
+	/**
+	* @brief Writes a message from a call site with variable arguments. This is what the logging macros use.
+	* @param site The call site, which has to have static storage duration.
+	* @param arguments The variable arguments to pass to the formatting function.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <StringLiteral STemplate, _Loggable... TArguments>
+		requires (PlaceholderCountMatchesArgumentCount<STemplate, TArguments...>())
+	inline void WriteLog(
+		const CallSite& site,
+		TArguments&&... arguments
+	) {
+		_WriteLog<STemplate>(
+			&site,
+			site.Level,
+			site.Module,
+			site.Line,
+			site.Function,
+			std::forward<TArguments>(arguments)...
+		);
+	};
+
+	/**
+	* @brief Appends a placeholder for the number of suppressed messages to the template.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <StringLiteral STemplate>
+	constexpr auto _SuppressedTemplate()
+	{
+		constexpr char suffix[] = " ({} similar messages suppressed)";
+		constexpr size_t NSize = sizeof(STemplate.Value) - 1ULL;
+		char value[NSize + sizeof(suffix)] = { };
+		size_t index = 0ULL;
+		while (index < NSize)
+		{
+			value[index] = STemplate.Value[index];
+			index += 1ULL;
+		}
+
+		while (index < NSize + sizeof(suffix))
+		{
+			value[index] = suffix[index - NSize];
+			index += 1ULL;
+		}
+
+		return StringLiteral<NSize + sizeof(suffix)>(value);
+	}
+
+	/**
+	* @brief Helper for the sampling macros. Writes the message and reports how many messages of the call site were suppressed since the last one. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <StringLiteral STemplate, _Loggable... TArguments>
+		requires (PlaceholderCountMatchesArgumentCount<STemplate, TArguments...>())
+	inline void WriteSampledLog(
+		uint64_t suppressed,
+		const CallSite& site,
+		TArguments&&... arguments
+	) {
+		if (suppressed == 0ULL)
+		{
+			WriteLog<STemplate>(
+				site,
+				std::forward<TArguments>(arguments)...
+			);
+		}
+		else
+		{
+			_WriteLog<_SuppressedTemplate<STemplate>()>(
+				&site,
+				site.Level,
+				site.Module,
+				site.Line,
+				site.Function,
+				std::forward<TArguments>(arguments)...,
+				suppressed
+			);
+		}
+	};
+
+	/**
+	* @brief Per-call-site token bucket for `LogRateLimited`. Implemented as a generic cell rate algorithm, so the whole bucket is a single atomic timestamp.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _RateLimiter final
+	{
+	public:
+		std::atomic<int64_t> TheoreticalArrival = 0LL;	///< In nanoseconds of the steady clock.
+		std::atomic<uint64_t> Suppressed = 0ULL;
+
+		/**
+		* @brief Takes a token from the bucket. The bucket holds up to one second worth of tokens, but at least one.
+		*
+		* A suppressed call reads the clock and the arrival time and adds itself to the shared count with a single relaxed increment, so every suppressed call is reported by the next message that is written.
+		*
+		* @param perSecond The number of tokens added per second. A rate that is not positive never writes.
+		* @param suppressed Receives the number of calls that were suppressed since the last successful one.
+		* @return True if the message should be written.
+		*/
+		inline bool TryAcquire(
+			double perSecond,
+			uint64_t& suppressed
+		) {
+			// Also false for NaN
+			if ((perSecond > 0.0) == false)
+			{
+				return false;
+			}
+
+			const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()
+			).count();
+			const int64_t interval = std::max<int64_t>(
+				static_cast<int64_t>(1000000000.0 / perSecond),
+				1LL
+			);
+			const int64_t burst = std::max<int64_t>(
+				interval,
+				1000000000LL
+			);
+
+			int64_t arrival = this->TheoreticalArrival.load(
+				std::memory_order_relaxed
+			);
+			do
+			{
+				if (arrival + interval - burst > now)
+				{
+					this->Suppressed.fetch_add(
+						1ULL,
+						std::memory_order_relaxed
+					);
+					return false;
+				}
+			}
+			while (this->TheoreticalArrival.compare_exchange_weak(arrival, std::max<int64_t>(arrival, now) + interval, std::memory_order_relaxed) == false);
+
+			suppressed = this->Suppressed.exchange(
+				0ULL,
+				std::memory_order_relaxed
+			);
+			return true;
+		};
+	};
+
+	/**
+	* @brief Helper for rollups. The aggregates of a single argument within one window. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _RollupValue final
+	{
+	public:
+		std::atomic<double> Minimum = 0.0;
+		std::atomic<double> Maximum = 0.0;
+		std::atomic<double> Sum = 0.0;
+	};
+
+	/**
+	* @brief Helper for rollups. The counters one thread keeps for one call site.
+	*
+	* Only the owning thread writes. It alternates between two slots by window and marks the slot as busy while it writes, so the thread closing a window can wait for it before merging.
+	*
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _RollupAccumulator final
+	{
+	public:
+		struct Slot final
+		{
+		public:
+			std::atomic<uint64_t> Window = 0ULL;
+			std::atomic<uint64_t> Count = 0ULL;
+			std::atomic<bool> Busy = false;
+			_RollupValue* Values = nullptr;		///< One per argument, owned by whoever owns the slot.
+		};
+
+		Slot Slots[2];
+		uint64_t Window = 0ULL;		///< The window the thread added its last message to; only read by the thread.
+		uint64_t Calls = 0ULL;		///< Only read by the thread.
+	};
+
+	struct _RollupShared;
+	struct _RollupSite;
+
+	/**
+	* @brief Helper for rollups. Registers the process for expedited memory barriers (Linux only). Standalone use not supported.
+	* @return True if closing a window orders the memory accesses of every thread; false if every message has to use a full fence.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API bool _RegisterHeavyBarrier();
+
+	/**
+	* @brief Helper for rollups. Registers a call site, so the background worker closes its windows. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API void _RegisterRollup(
+		_RollupSite& site
+	);
+
+	/**
+	* @brief Helper for rollups. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API void _UnregisterRollup(
+		_RollupSite& site
+	);
+
+	/**
+	* @brief Helper for rollups. Registers the counters of a thread with its call site. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API void _AttachRollup(
+		_RollupSite& site,
+		_RollupAccumulator& accumulator
+	);
+
+	/**
+	* @brief Helper for rollups. Removes the counters of a thread that exits from its call site. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API void _DetachRollup(
+		_RollupSite& site,
+		_RollupAccumulator& accumulator
+	);
+
+	/**
+	* @brief Helper for rollups. Closes the open window of the call site, merges the counters of all threads and writes the summary. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API void _CloseRollup(
+		_RollupSite& site,
+		int64_t now,
+		bool force
+	);
+
+	/**
+	* @brief Helper for rollups. The state of one call site. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _RollupSite final
+	{
+	public:
+	#ifdef __linux__
+		static constexpr uint64_t ClockInterval = 64ULL;	///< The background worker closes the windows, so a thread only reads the clock every this many messages.
+	#else
+		static constexpr uint64_t ClockInterval = 1ULL;
+	#endif // __linux__
+
+		_RollupSite(
+			const CallSite& site,
+			std::chrono::milliseconds window,
+			const int* kinds,
+			size_t count
+		) : Site(site),
+			Length(std::chrono::duration_cast<std::chrono::nanoseconds>(window).count()),
+			Kinds(kinds),
+			ArgumentCount(count),
+			Asymmetric(_RegisterHeavyBarrier())
+		{
+			_RegisterRollup(
+				*this
+			);
+		};
+
+		_RollupSite(const _RollupSite&) = delete;
+		_RollupSite& operator=(const _RollupSite&) = delete;
+
+		~_RollupSite()
+		{
+			_UnregisterRollup(
+				*this
+			);
+		};
+
+		const CallSite& Site;
+		const int64_t Length;						///< The length of a window in nanoseconds.
+		const int* Kinds;
+		const size_t ArgumentCount;
+		const bool Asymmetric;						///< Whether closing a window orders the messages with a heavy barrier.
+		_RollupShared* Shared = nullptr;			///< The threads and the counters of the threads that exited, kept by the logger.
+		std::atomic<uint64_t> Window = 1ULL;
+		std::atomic<int64_t> Deadline = 0LL;
+	};
+
+	/**
+	* @brief Helper for rollups. Registers the counters of a thread with its call site for the lifetime of the thread. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <size_t NCount>
+	struct _RollupThread final
+	{
+	public:
+		_RollupThread(
+			_RollupSite& site
+		) : Site(site)
+		{
+			this->Accumulator.Slots[0].Values = this->Values[0].data();
+			this->Accumulator.Slots[1].Values = this->Values[1].data();
+			_AttachRollup(
+				this->Site,
+				this->Accumulator
+			);
+		};
+
+		_RollupThread(const _RollupThread&) = delete;
+		_RollupThread& operator=(const _RollupThread&) = delete;
+
+		~_RollupThread()
+		{
+			_DetachRollup(
+				this->Site,
+				this->Accumulator
+			);
+		};
+
+		_RollupSite& Site;
+		_RollupAccumulator Accumulator = _RollupAccumulator();
+		std::array<std::array<_RollupValue, NCount>, 2ULL> Values = { };
+	};
+
+	/**
+	* @brief Helper for rollups. The side of a barrier that every message takes: only keeps the compiler from reordering if `_HeavyBarrier` orders the thread, else a full fence. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _LightBarrier(
+		bool asymmetric
+	) {
+		if (asymmetric == true)
+		{
+			std::atomic_signal_fence(
+				std::memory_order_seq_cst
+			);
+		}
+		else
+		{
+			std::atomic_thread_fence(
+				std::memory_order_seq_cst
+			);
+		}
+	};
+
+	/**
+	* @brief Helper for rollups. Adds a single argument to the counters of the calling thread. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <typename TArgument>
+	inline void _AccumulateRollup(
+		_RollupValue& value,
+		bool first,
+		const TArgument& argument
+	) {
+		if constexpr (std::is_arithmetic_v<std::remove_cvref_t<TArgument>> == true)
+		{
+			double number = static_cast<double>(argument);
+			if (first == true)
+			{
+				value.Minimum.store(number, std::memory_order_relaxed);
+				value.Maximum.store(number, std::memory_order_relaxed);
+				value.Sum.store(number, std::memory_order_relaxed);
+				return;
+			}
+
+			if (number < value.Minimum.load(std::memory_order_relaxed))
+			{
+				value.Minimum.store(number, std::memory_order_relaxed);
+			}
+
+			if (number > value.Maximum.load(std::memory_order_relaxed))
+			{
+				value.Maximum.store(number, std::memory_order_relaxed);
+			}
+
+			value.Sum.store(
+				value.Sum.load(std::memory_order_relaxed) + number,
+				std::memory_order_relaxed
+			);
+		}
+	};
+
+	/**
+	* @brief Aggregates the messages of a call site instead of writing them. Once per window a single summary with the count and the minimum, average, maximum and sum of every numeric argument is written.
+	*
+	* The counters are kept per thread and merged when the window is closed, either by a message that finds the window has passed or by the background worker. On Linux the background worker closes the windows, so a thread only reads the clock every 64th message.
+	* A message only marks the slot of its thread busy and checks the window it last used; the thread that closes a window pays for ordering the two (`_HeavyBarrier`).
+	* The call site is filtered like any other call site, so categories, the filter and call site overrides apply.
+	* Use the `LogRollup` macro instead of calling this directly; the `TCallSite` type makes every call site unique.
+	*
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <StringLiteral STemplate, typename TCallSite, _Loggable... TArguments>
+		requires (PlaceholderCountMatchesArgumentCount<STemplate, TArguments...>())
+	inline void WriteRollup(
+		TCallSite,
+		const CallSite& callSite,
+		std::chrono::milliseconds window,
+		const TArguments&... arguments
+	) {
+		// The level of the call site covers its state; the hits are counted per thread and added when the window is closed
+		if (callSite.Level > _CallSiteSeverity(callSite))
+		{
+			return;
+		}
+
+		static constexpr int kinds[sizeof...(TArguments) + 1ULL] = { (std::is_integral_v<std::remove_cvref_t<TArguments>> == true ? 1 : std::is_floating_point_v<std::remove_cvref_t<TArguments>> == true ? 2 : 0)..., 0 };
+		static _RollupSite site = _RollupSite(
+			callSite,
+			window,
+			kinds,
+			sizeof...(TArguments)
+		);
+		thread_local _RollupThread<sizeof...(TArguments)> counters = _RollupThread<sizeof...(TArguments)>(
+			site
+		);
+
+		_RollupAccumulator& accumulator = counters.Accumulator;
+		accumulator.Calls += 1ULL;
+		if (accumulator.Calls % _RollupSite::ClockInterval == 0ULL)
+		{
+			const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()
+			).count();
+			if (now >= site.Deadline.load(std::memory_order_relaxed))
+			{
+				_CloseRollup(
+					site,
+					now,
+					false
+				);
+			}
+		}
+
+		// The slot is marked busy before the window is confirmed, so a window is never closed while a message is added to it
+		uint64_t current = accumulator.Window;
+		_RollupAccumulator::Slot* slot = nullptr;
+		while (true)
+		{
+			slot = &accumulator.Slots[current % 2ULL];
+			slot->Busy.store(
+				true,
+				std::memory_order_relaxed
+			);
+			_LightBarrier(
+				site.Asymmetric
+			);
+			uint64_t confirmed = site.Window.load(
+				std::memory_order_relaxed
+			);
+			if (confirmed == current)
+			{
+				break;
+			}
+
+			slot->Busy.store(
+				false,
+				std::memory_order_release
+			);
+			current = confirmed;
+		}
+
+		accumulator.Window = current;
+		bool first = slot->Window.load(std::memory_order_relaxed) != current;
+		if (first == true)
+		{
+			slot->Count.store(
+				0ULL,
+				std::memory_order_relaxed
+			);
+			slot->Window.store(
+				current,
+				std::memory_order_relaxed
+			);
+		}
+
+		size_t index = 0ULL;
+		((_AccumulateRollup(slot->Values[index], first, arguments), index += 1ULL), ...);
+		slot->Count.store(
+			slot->Count.load(std::memory_order_relaxed) + 1ULL,
+			std::memory_order_relaxed
+		);
+		slot->Busy.store(
+			false,
+			std::memory_order_release
+		);
+	};
+
+	// Weird macro magic to get the line number
+	#define STRINGIFY(x) #x
+	#define AS_STRING(x) STRINGIFY(x)
+	#define LINE_AS_STRING AS_STRING(__LINE__)
+
+	// Declares the call site of a logging macro (the level is given as the name of the level)
+	#define CALL_SITE(level, template) static const SimpleLog::CallSite simpleLogSite = SimpleLog::CallSite(SimpleLog::LogLevels::level, __FILE__, LINE_AS_STRING, __func__, template)
+	// Same with a category, whose name is hashed at compile time and registered once
+	#define CALL_SITE_IN(category, level, template) static const SimpleLog::CallSite simpleLogSite = SimpleLog::CallSite(SimpleLog::LogLevels::level, __FILE__, LINE_AS_STRING, __func__, template, SimpleLog::RegisterCategory(category, std::integral_constant<uint64_t, SimpleLog::HashCategory(category)>::value))
+	// The call site as an expression, so the logging macros can be used wherever a function call can (__func__ is passed in, inside the lambda it would name the lambda)
+	#define CALL_SITE_OF(level, template) [](const char* simpleLogFunction) -> const SimpleLog::CallSite& { static const SimpleLog::CallSite simpleLogSite = SimpleLog::CallSite(SimpleLog::LogLevels::level, __FILE__, LINE_AS_STRING, simpleLogFunction, template); return simpleLogSite; }(__func__)
+	#define CALL_SITE_OF_IN(category, level, template) [](const char* simpleLogFunction) -> const SimpleLog::CallSite& { static const SimpleLog::CallSite simpleLogSite = SimpleLog::CallSite(SimpleLog::LogLevels::level, __FILE__, LINE_AS_STRING, simpleLogFunction, template, SimpleLog::RegisterCategory(category, std::integral_constant<uint64_t, SimpleLog::HashCategory(category)>::value)); return simpleLogSite; }(__func__)
+
+	// Logging functions for easier use (__FILE__, __LINE__ and __func__ are automatically included)
+	#define LogAt(level, template, ...) SimpleLog::WriteLog<template>(CALL_SITE_OF(level, template) __VA_OPT__(,) __VA_ARGS__)
+	#define LogTrace(template, ...) LogAt(Trace, template __VA_OPT__(,) __VA_ARGS__)
+	#define LogDebug(template, ...) LogAt(Debug, template __VA_OPT__(,) __VA_ARGS__)
+	#define LogInformation(template, ...) LogAt(Information, template __VA_OPT__(,) __VA_ARGS__)
+	#define LogWarning(template, ...) LogAt(Warning, template __VA_OPT__(,) __VA_ARGS__)
+	#define LogError(template, ...) LogAt(Error, template __VA_OPT__(,) __VA_ARGS__)
+	#define LogCritical(template, ...) LogAt(Critical, template __VA_OPT__(,) __VA_ARGS__)
+
+	// Logging functions with a category (e.g. LogDebugC("net.http", "..."))
+	#define LogAtC(category, level, template, ...) SimpleLog::WriteLog<template>(CALL_SITE_OF_IN(category, level, template) __VA_OPT__(,) __VA_ARGS__)
+	#define LogTraceC(category, template, ...) LogAtC(category, Trace, template __VA_OPT__(,) __VA_ARGS__)
+	#define LogDebugC(category, template, ...) LogAtC(category, Debug, template __VA_OPT__(,) __VA_ARGS__)
+	#define LogInformationC(category, template, ...) LogAtC(category, Information, template __VA_OPT__(,) __VA_ARGS__)
+	#define LogWarningC(category, template, ...) LogAtC(category, Warning, template __VA_OPT__(,) __VA_ARGS__)
+	#define LogErrorC(category, template, ...) LogAtC(category, Error, template __VA_OPT__(,) __VA_ARGS__)
+	#define LogCriticalC(category, template, ...) LogAtC(category, Critical, template __VA_OPT__(,) __VA_ARGS__)
+
+	// Sampling functions, each call site keeps its own counter (the level is given as the name of the level, e.g. LogOnce(Warning, "..."))
+	// Suppressed calls neither evaluate the arguments nor format anything; the lambda captures the arguments by reference, so the macros are expressions like LogAt
+	#define LogEveryN(level, n, template, ...) [&](const char* simpleLogFunction) -> void \
+		{ \
+			static const SimpleLog::CallSite simpleLogSite = SimpleLog::CallSite(SimpleLog::LogLevels::level, __FILE__, LINE_AS_STRING, simpleLogFunction, template); \
+			static std::atomic<uint64_t> simpleLogCalls = 0ULL; \
+			uint64_t simpleLogCall = simpleLogCalls.fetch_add(1ULL, std::memory_order_relaxed); \
+			if (static_cast<uint64_t>(n) != 0ULL \
+				&& simpleLogCall % static_cast<uint64_t>(n) == 0ULL) \
+			{ \
+				SimpleLog::WriteSampledLog<template>(simpleLogCall == 0ULL ? 0ULL : static_cast<uint64_t>(n) - 1ULL, simpleLogSite __VA_OPT__(,) __VA_ARGS__); \
+			} \
+		}(__func__)
+	#define LogFirstN(level, n, template, ...) [&](const char* simpleLogFunction) -> void \
+		{ \
+			static const SimpleLog::CallSite simpleLogSite = SimpleLog::CallSite(SimpleLog::LogLevels::level, __FILE__, LINE_AS_STRING, simpleLogFunction, template); \
+			static std::atomic<uint64_t> simpleLogCalls = 0ULL; \
+			if (simpleLogCalls.load(std::memory_order_relaxed) < static_cast<uint64_t>(n) \
+				&& simpleLogCalls.fetch_add(1ULL, std::memory_order_relaxed) < static_cast<uint64_t>(n)) \
+			{ \
+				SimpleLog::WriteLog<template>(simpleLogSite __VA_OPT__(,) __VA_ARGS__); \
+			} \
+		}(__func__)
+	#define LogOnce(level, template, ...) LogFirstN(level, 1ULL, template __VA_OPT__(,) __VA_ARGS__)
+	#define LogRateLimited(level, perSecond, template, ...) [&](const char* simpleLogFunction) -> void \
+		{ \
+			static const SimpleLog::CallSite simpleLogSite = SimpleLog::CallSite(SimpleLog::LogLevels::level, __FILE__, LINE_AS_STRING, simpleLogFunction, template); \
+			static SimpleLog::_RateLimiter simpleLogLimiter; \
+			uint64_t simpleLogSuppressed = 0ULL; \
+			if (simpleLogLimiter.TryAcquire(static_cast<double>(perSecond), simpleLogSuppressed) == true) \
+			{ \
+				SimpleLog::WriteSampledLog<template>(simpleLogSuppressed, simpleLogSite __VA_OPT__(,) __VA_ARGS__); \
+			} \
+		}(__func__)
+
+	// Rollup function, the call site writes a single summary per window instead of a line per message
+	#define LogRollup(level, window, template, ...) SimpleLog::WriteRollup<template>([](){ }, CALL_SITE_OF(level, template), std::chrono::duration_cast<std::chrono::milliseconds>(window) __VA_OPT__(,) __VA_ARGS__)
+}
+SIMPLELOG_VISIBILITY_END
+
+#ifndef SIMPLELOG_COMPILED
+#include "SimpleLog.ipp"
+#endif // SIMPLELOG_COMPILED
@@ -1,929 +1,7956 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
+#include <cerrno>
 #include <chrono>
+#include <cmath>
 #include <concepts>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <ctime>
+#include <deque>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <source_location>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif // __AVX2__ or __SSE2__
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/inotify.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/timerfd.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <linux/membarrier.h>
+#endif // __linux__
+
+#include "SimpleLog.hpp"
+
+// The functions SimpleLog.hpp declares are defined in every translation unit when header-only and only in SimpleLog.cpp with SIMPLELOG_COMPILED
+#if !defined(SIMPLELOG_COMPILED) || defined(SIMPLELOG_BACKEND)
+#define SIMPLELOG_DEFINE_BACKEND
+#endif // SIMPLELOG_COMPILED
 
 /**
 * @brief A small header-only logging library.
 * @author Narumikazuchi
 * @date 06.05.2025
 */
+SIMPLELOG_VISIBILITY_BEGIN
 namespace SimpleLog
 {
 	/**
-	* @brief Represents known string-like types.
+	* @brief A single message as it is handed to the outputs. All values are only valid while the record is written.
 	* @author Narumikazuchi
-	* @date 06.05.2025
+	* @date 16.10.2026
 	*/
-	template <typename TString>
-	concept _StringLike =
-		std::is_base_of_v<std::string, std::remove_cvref_t<TString>>
-		|| std::is_base_of_v<std::string_view, std::remove_cvref_t<TString>>
-		|| std::is_same_v<char*, std::remove_cvref_t<TString>>
-		|| std::is_same_v<char* const, std::remove_cvref_t<TString>>
-		|| std::is_same_v<const char*, std::remove_cvref_t<TString>>
-		|| std::is_same_v<const char* const, std::remove_cvref_t<TString>>;
+	struct LogRecord final
+	{
+	public:
+		std::chrono::system_clock::time_point Time = std::chrono::system_clock::time_point();
+		LogLevel Level = LogLevels::Disabled;
+		std::string_view Module = std::string_view();
+		std::string_view Line = std::string_view();
+		std::string_view Function = std::string_view();
+		std::string_view ThreadId = std::string_view();
+		std::string_view Template = std::string_view();
+		std::string_view Category = std::string_view();
+		uint8_t Sinks = CategorySinks::All;			///< The outputs the category of the record writes to.
+		const std::string* Arguments = nullptr;		///< The arguments, already turned into text.
+		const std::string_view* Names = nullptr;	///< The name of each argument given with `Field` or an empty view.
+		const bool* Numeric = nullptr;				///< Whether each argument is a number.
+		size_t ArgumentCount = 0ULL;
+		const CallSite* Site = nullptr;				///< The call site, if the record is written directly from one.
+	};
 
 	/**
-	* @brief Represents string-convertible types.
+	* @brief A single step of a compiled layout: a run of literal text or a column of the record.
 	* @author Narumikazuchi
-	* @date 06.05.2025
+	* @date 16.10.2026
 	*/
-	template <typename TString>
-	concept _StringConvertible =
-		std::is_convertible_v<std::remove_cvref_t<TString>, std::string>
-		|| std::is_convertible_v<std::remove_cvref_t<TString>, std::string_view>
-		|| std::is_convertible_v<std::remove_cvref_t<TString>, char*>
-		|| std::is_convertible_v<std::remove_cvref_t<TString>, char* const>
-		|| std::is_convertible_v<std::remove_cvref_t<TString>, const char*>
-		|| std::is_convertible_v<std::remove_cvref_t<TString>, const char* const>;
+	struct LayoutStep final
+	{
+	public:
+		enum class Kind : uint8_t
+		{
+			Literal,		///< Text copied from the pattern.
+			Time,			///< %T: HH:MM:SS in local time.
+			Date,			///< %D: YYYY-MM-DD in local time.
+			Milliseconds,	///< %e: The milliseconds of the timestamp (3 digits).
+			Level,			///< %L: The name of the level.
+			File,			///< %s: The source file without its directory.
+			Line,			///< %#: The line in the source file.
+			Location,		///< %S: File and line as "file:line".
+			Function,		///< %f: The function.
+			Thread,			///< %t: The id of the logging thread.
+			Message,		///< %m: The formatted message.
+			Category,		///< %c: The category of the message.
+			Microseconds	///< %u: The microseconds of the timestamp (6 digits).
+		};
+
+		Kind Type = Kind::Literal;
+		bool LeftAlign = false;
+		uint16_t Width = 0U;
+		uint16_t Begin = 0U;	///< The offset of the literal text in the layout.
+		uint16_t Length = 0U;	///< The length of the literal text.
+	};
 
 	/**
-	* @brief Helper to check if a type is castable to another.
+	* @brief A pattern compiled into a flat list of steps. Compiled at compile time if the layout is constexpr and the pattern is a literal.
+	*
+	* A pattern consists of literal text and specifiers of the form `%[-][width]<kind>` (see `LayoutStep::Kind`). A width pads the column with spaces, on the right if `-` is given; `%%` writes a single percent sign.
+	*
 	* @author Narumikazuchi
-	* @date 25.07.2025
+	* @date 16.10.2026
 	*/
-	template <typename TFrom, typename TTo>
-	concept _Castable = requires (
-		TFrom from
-	) {
-		{ static_cast<TTo>(from) } -> std::same_as<TTo>;
+	struct Layout final
+	{
+	public:
+		static constexpr size_t MaximumSteps = 32ULL;
+		static constexpr size_t MaximumLiterals = 256ULL;
+
+		constexpr Layout() = default;
+
+		constexpr explicit Layout(
+			std::string_view pattern
+		) {
+			size_t index = 0ULL;
+			while (index < pattern.size())
+			{
+				if (pattern[index] != '%')
+				{
+					this->AppendLiteral(
+						pattern[index]
+					);
+					index += 1ULL;
+					continue;
+				}
+
+				index += 1ULL;
+				if (index < pattern.size()
+					&& pattern[index] == '%')
+				{
+					this->AppendLiteral(
+						'%'
+					);
+					index += 1ULL;
+					continue;
+				}
+
+				LayoutStep step = LayoutStep();
+				if (index < pattern.size()
+					&& pattern[index] == '-')
+				{
+					step.LeftAlign = true;
+					index += 1ULL;
+				}
+
+				size_t width = 0ULL;
+				while (index < pattern.size()
+					   && pattern[index] >= '0'
+					   && pattern[index] <= '9')
+				{
+					width = width * 10ULL + static_cast<size_t>(pattern[index] - '0');
+					index += 1ULL;
+				}
+
+				if (index >= pattern.size()
+					|| width > 1024ULL)
+				{
+					throw std::invalid_argument(
+						"Incomplete specifier in layout pattern."
+					);
+				}
+
+				step.Width = static_cast<uint16_t>(width);
+				// The specifiers are in the same order as the kinds
+				constexpr std::string_view specifiers = std::string_view("TDeLs#Sftmcu");
+				size_t kind = specifiers.find(
+					pattern[index]
+				);
+				if (kind == std::string_view::npos)
+				{
+					throw std::invalid_argument(
+						"Unknown specifier in layout pattern."
+					);
+				}
+
+				step.Type = static_cast<LayoutStep::Kind>(kind + 1ULL);
+				this->AppendStep(
+					step
+				);
+				index += 1ULL;
+			}
+		};
+
+		std::array<LayoutStep, MaximumSteps> Steps = { };
+		size_t Count = 0ULL;
+		std::array<char, MaximumLiterals> Literals = { };
+		size_t LiteralsUsed = 0ULL;
+
+	private:
+		constexpr void AppendStep(
+			const LayoutStep& step
+		) {
+			if (this->Count >= MaximumSteps)
+			{
+				throw std::invalid_argument(
+					"Too many specifiers in layout pattern."
+				);
+			}
+
+			this->Steps[this->Count] = step;
+			this->Count += 1ULL;
+		};
+
+		constexpr void AppendLiteral(
+			char character
+		) {
+			if (this->LiteralsUsed >= MaximumLiterals)
+			{
+				throw std::invalid_argument(
+					"Too much literal text in layout pattern."
+				);
+			}
+
+			// Consecutive literal characters form a single step
+			if (this->Count == 0ULL
+				|| this->Steps[this->Count - 1ULL].Type != LayoutStep::Kind::Literal)
+			{
+				LayoutStep step = LayoutStep();
+				step.Begin = static_cast<uint16_t>(this->LiteralsUsed);
+				this->AppendStep(
+					step
+				);
+			}
+
+			this->Literals[this->LiteralsUsed] = character;
+			this->LiteralsUsed += 1ULL;
+			this->Steps[this->Count - 1ULL].Length += 1U;
+		};
 	};
 
 	/**
-	* @brief Represents string-castable types.
+	* @brief The default layouts, which write the same columns as earlier versions.
 	* @author Narumikazuchi
-	* @date 25.07.2025
+	* @date 16.10.2026
 	*/
-	template <typename TValue>
-	concept _StringCastable = 
-		_Castable<TValue, std::string>
-		|| _Castable<TValue, const std::string>
-		|| _Castable<TValue, std::string_view>
-		|| _Castable<TValue, const std::string_view>
-		|| _Castable<TValue, char*>
-		|| _Castable<TValue, const char*>
-		|| _Castable<TValue, char* const>
-		|| _Castable<TValue, const char* const>;
+	namespace Layouts
+	{
+		inline constexpr Layout Default = Layout("%T\t\t[%-12L]\t\t%-64S\t\t%-32f\t\t%m");
+		inline constexpr Layout DefaultWithThread = Layout("%T\t\t[%-12L]\t\tThread #%t\t\t%-64S\t\t%-32f\t\t%m");
+	}
 
 	/**
-	* @brief Represents string-appendable types.
+	* @brief Provides all configuration valus that influence the logger.
 	* @author Narumikazuchi
-	* @date 06.05.2025
+	* @date 01.07.2025
 	*/
-	template <typename TValue>
-	concept _StringAppendable = requires(
-		std::string string,
-		TValue value
-	) {
-		{ string += value };
+	struct LoggerConfiguration final
+	{
+	public:
+		std::filesystem::path LogDirectory	= std::filesystem::path();
+		LogLevel Severity					= LogLevels::Warning;
+		std::string FileNamePrefix			= std::string();
+		std::string FileNamePostfix			= std::string();
+		std::string Pattern					= std::string();
+		std::string Filter					= std::string();
+		std::filesystem::path ConfigFile	= std::filesystem::path();
+		std::filesystem::path ControlSocket	= std::filesystem::path();
+		bool WriteThreadId					= false;
+		bool WriteToConsole					= false;
+		bool WriteToFile					= true;
+		bool WriteToJsonFile				= false;
+		bool FlushOnCrash					= false;
+		std::filesystem::path FlightRecorderFile	= std::filesystem::path();
+		size_t FlightRecorderSize			= 16ULL * 1024ULL * 1024ULL;
+		size_t BacktraceSize				= 0ULL;
+		bool DeduplicateMessages			= false;
+		std::chrono::milliseconds DeduplicateInterval	= std::chrono::seconds(30);
+		bool ProfileCallSites				= false;
+		std::filesystem::path MetricsFile	= std::filesystem::path();
+		std::chrono::milliseconds MetricsInterval	= std::chrono::seconds(15);
+		bool AllocationFree					= false;
 	};
 
+	inline const LoggerConfiguration& CurrentConfiguration();
+
 	/**
-	* @brief Represents stringifyable types.
+	* @brief Helper function for layouts. The layout set by `ConfigureLayout` or compiled from `LoggerConfiguration::Pattern`, if any. Standalone use not supported.
 	* @author Narumikazuchi
-	* @date 06.05.2025
+	* @date 16.10.2026
 	*/
-	template <typename TValue>
-	concept _StdStringify = requires(
-		TValue value
-	) {
-		{ std::to_string(value) } -> std::same_as<std::string>;
-	};
+	inline std::atomic<const Layout*>& _ActiveLayout()
+	{
+		static std::atomic<const Layout*> layout = nullptr;
+
+		return layout;
+	}
 
 	/**
-	* @brief Represents stringifyable types.
+	* @brief Helper function for layouts. Gets the layout records are written with. Standalone use not supported.
 	* @author Narumikazuchi
-	* @date 06.05.2025
+	* @date 16.10.2026
 	*/
-	template <typename TValue>
-	concept _Stringify =
-		requires(TValue value) { { value.ToString() } -> std::same_as<std::string>; }
-		|| requires(TValue value) { { value.ToString() } -> std::same_as<const std::string&>; }
-		|| requires(TValue value) { { value.ToString() } -> std::same_as<std::string_view>; }
-		|| requires(TValue value) { { value.ToString() } -> std::same_as<const std::string_view&>; }
-		|| requires(TValue value) { { value.ToString() } -> std::same_as<char*>; }
-		|| requires(TValue value) { { value.ToString() } -> std::same_as<char* const>; }
-		|| requires(TValue value) { { value.ToString() } -> std::same_as<const char*>; }
-		|| requires(TValue value) { { value.ToString() } -> std::same_as<const char* const>; };
+	inline const Layout& _CurrentLayout()
+	{
+		const Layout* layout = _ActiveLayout().load(
+			std::memory_order_acquire
+		);
+		if (layout != nullptr)
+		{
+			return *layout;
+		}
+
+		return CurrentConfiguration().WriteThreadId == true ? Layouts::DefaultWithThread : Layouts::Default;
+	}
 
 	/**
-	* @brief Represents loggable types.
+	* @brief Helper function for layouts. Compiles the pattern of the configuration. Standalone use not supported.
+	*
+	* A published layout is never changed or freed, since a record may still be written with it; every distinct pattern is compiled once and kept for the lifetime of the process.
+	*
 	* @author Narumikazuchi
-	* @date 06.05.2025
+	* @date 16.10.2026
 	*/
-	template <typename TValue>
-	concept _Loggable =
-		_StringLike<TValue>
-		|| _StringConvertible<TValue>
-		|| _StringAppendable<TValue>
-		|| _StdStringify<TValue>
-		|| _Stringify<TValue>;
+	inline void _ConfigurePattern(
+		const std::string& pattern
+	) {
+		static std::mutex mutex;
+		static std::deque<std::pair<std::string, Layout>> layouts = std::deque<std::pair<std::string, Layout>>();
+
+		if (pattern.empty() == true)
+		{
+			_ActiveLayout().store(
+				nullptr,
+				std::memory_order_release
+			);
+			return;
+		}
+
+		// Reconfiguring and reloading the configuration file can happen at the same time
+		std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+			mutex
+		);
+		for (const std::pair<std::string, Layout>& layout : layouts)
+		{
+			if (layout.first == pattern)
+			{
+				_ActiveLayout().store(
+					&layout.second,
+					std::memory_order_release
+				);
+				return;
+			}
+		}
+
+		// Compiled first, so an invalid pattern leaves nothing behind; the elements of a deque never move
+		Layout compiled = Layout(pattern);
+		layouts.emplace_back(
+			pattern,
+			compiled
+		);
+		_ActiveLayout().store(
+			&layouts.back().second,
+			std::memory_order_release
+		);
+	};
 
 	/**
-	* @brief Represents a string literal for template parameters.
+	* @brief Sets a layout whose pattern is compiled at compile time. Overrides `LoggerConfiguration::Pattern` until the logger is configured again.
 	* @author Narumikazuchi
-	* @date 06.05.2025
+	* @date 16.10.2026
 	*/
-	template <size_t NSize>
-	struct StringLiteral final
+	template <StringLiteral SPattern>
+	inline void ConfigureLayout()
 	{
-	public:
-		constexpr StringLiteral(
-			const char (&value)[NSize]
-		) : Value()
-		{
-			size_t index = 0ULL;
-			while (index < NSize)
-			{
-				this->Value[index] = value[index];
-				index += 1ULL;
-			}
-		};
+		static constexpr Layout layout = Layout(std::string_view(SPattern.Value, sizeof(SPattern.Value) - 1ULL));
 
-		~StringLiteral() = default;
+		_ActiveLayout().store(
+			&layout,
+			std::memory_order_release
+		);
+	};
+
+	/**
+	* @brief Helper for filters. A single rule of a filter spec. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _FilterRule final
+	{
+	public:
+		std::string Pattern = std::string();	///< A file name, function or category; empty for '*'.
+		LogLevel Level = LogLevels::Disabled;
 
-		char Value[NSize];
+		bool operator==(
+			const _FilterRule& other
+		) const {
+			return this->Pattern == other.Pattern
+				   && this->Level == other.Level;
+		};
 	};
 
 	/**
-	* @brief Counts and checks whether the number of placeholders in the SValue literal matches the number of TArguments.
+	* @brief Helper for filters. The compiled filter spec and the generation every call site tags its cached decision with. Standalone use not supported.
+	*
+	* A compiled spec is published once and never changed or freed afterwards, so the level of a message is resolved without a lock.
+	*
 	* @author Narumikazuchi
-	* @date 06.05.2025
+	* @date 16.10.2026
 	*/
-	template <StringLiteral SValue, typename... TArguments>
-	constexpr bool PlaceholderCountMatchesArgumentCount()
+	struct _Filter final
 	{
-		constexpr size_t NSize = sizeof(SValue.Value);
-		size_t index = 0ULL;
-		size_t count = 0ULL;
+	public:
+		static constexpr uint8_t NoRule = 0xFFU;	///< No rule matches; the level of the category applies.
 
-		char lastCharacter = 0;
-		while (index < NSize)
-		{
-			if (SValue.Value[index] == '}'
-				&& lastCharacter == '{')
-			{
-				count += 1ULL;
-			}
+		// Guards publishing the rules and the settings, readers never lock
+		std::mutex Mutex = std::mutex();
+		std::deque<std::vector<_FilterRule>> Published = std::deque<std::vector<_FilterRule>>();
+	};
 
-			lastCharacter = SValue.Value[index];
-			index += 1ULL;
-		}
+	/**
+	* @brief Helper for filters. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline _Filter& _CurrentFilter()
+	{
+		static _Filter filter = _Filter();
 
-		return count == sizeof...(TArguments);
+		return filter;
 	}
 
 	/**
-	* @brief Enumeration representing different log levels.
+	* @brief Helper for filters. Makes every call site resolve its level again on its next message. Standalone use not supported.
 	* @author Narumikazuchi
-	* @date 06.05.2025
+	* @date 16.10.2026
 	*/
-	enum class LogSeverity : uint8_t
+	inline void _InvalidateCallSites()
 	{
-		Disabled	= 0,	///< Logging is disabled.
-		Critical	= 1,	///< Critical errors that will crash the application.
-		Error		= 2,	///< Errors that keep a feature from functioning, but do not crash the entire application.
-		Warning		= 3,	///< Warnings that indicate potential problems.
-		Information	= 4,	///< Informational messages to provide context or status updates.
-		Debug		= 5,	///< Detailed debugging information (only used during development).
-		Trace		= 6,	///< Information detailing the order of events in the entire application.
+		_SettingsGeneration().fetch_add(
+			1ULL,
+			std::memory_order_release
+		);
 	};
 
 	/**
-	* @brief A wrapper class for working with log levels as values and providing utility functions.
+	* @brief Helper for categories. A single registered category; its own settings and the effective ones resolved through its parents. Standalone use not supported.
 	* @author Narumikazuchi
-	* @date 06.05.2025
+	* @date 16.10.2026
 	*/
-	struct LogLevel final
+	struct _Category final
 	{
 	public:
-		/**
-		* @brief Parse a string representation of a log level into a `LogLevel` object.
-		* @param value The string to parse (case-insensitive).
-		* @return A `LogLevel` object representing the parsed log level, or `LogLevels::Disabled` if parsing fails.
-		* @author Narumikazuchi
-		* @date 20.06.2025
-		*/
-		static inline LogLevel Parse(
-			const std::string& value
-		) {
-			std::string_view view = value;
-			return LogLevel::Parse(
-				view
-			);
-		};
-		/**
-		* @brief Parse a string representation of a log level into a `LogLevel` object.
-		* @param value The string to parse (case-insensitive).
-		* @return A `LogLevel` object representing the parsed log level, or `LogLevels::Disabled` if parsing fails.
-		* @author Narumikazuchi
-		* @date 20.06.2025
-		*/
-		static inline LogLevel Parse(
-			std::string_view value
-		) {
-			std::string lowered = std::string();
-			lowered.reserve(
-				value.size()
-			);
-			for (char character : value)
-			{
-				lowered.push_back(
-					std::tolower(
-						character
-					)
-				);
-			}
+		static constexpr uint8_t Inherit = 0xFFU;		///< No own setting; the effective level of the root means the global `Severity`.
+		static constexpr size_t MaximumNameLength = 64ULL;
 
-			static const std::string trace = std::string("trace");
-			static const std::string debug = std::string("debug");
-			static const std::string info = std::string("info");
-			static const std::string information = std::string("information");
-			static const std::string warn = std::string("warn");
-			static const std::string warning = std::string("warning");
-			static const std::string error = std::string("error");
-			static const std::string critical = std::string("critical");
-			if (lowered == trace)
-			{
-				return LogLevel(
-					LogSeverity::Trace
-				);
-			}
-			else if (lowered == debug)
-			{
-				return LogLevel(
-					LogSeverity::Debug
-				);
-			}
-			else if (lowered == information
-					|| lowered == info)
-			{
-				return LogLevel(
-					LogSeverity::Information
-				);
-			}
-			else if (lowered == warning
-					|| lowered == warn)
-			{
-				return LogLevel(
-					LogSeverity::Warning
-				);
-			}
-			else if (lowered == error)
-			{
-				return LogLevel(
-					LogSeverity::Error
-				);
-			}
-			else if (lowered == critical)
+		uint64_t Hash = 0ULL;
+		std::array<char, MaximumNameLength> Name = { };
+		size_t NameLength = 0ULL;
+		size_t Parent = 0ULL;
+		std::atomic<uint8_t> Level = Inherit;
+		std::atomic<uint8_t> Sinks = Inherit;
+		std::atomic<uint8_t> EffectiveLevel = Inherit;
+		std::atomic<uint8_t> EffectiveSinks = CategorySinks::All;
+	};
+
+	/**
+	* @brief Helper for categories. All registered categories; the index of a category never changes. Index 0 is the root, which every message without a category belongs to. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _CategoryTable final
+	{
+	public:
+		static constexpr size_t Capacity = 256ULL;
+
+		std::mutex Mutex = std::mutex();
+		std::array<_Category, Capacity> Categories = { };
+		std::atomic<size_t> Count = 1ULL;
+	};
+
+	/**
+	* @brief Helper for categories. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline _CategoryTable& _Categories()
+	{
+		static _CategoryTable table = _CategoryTable();
+
+		return table;
+	}
+
+	/**
+	* @brief Helper for categories. Resolves the effective level and sinks of every category; parents are always registered before their children. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _RefreshCategories(
+		_CategoryTable& table
+	) {
+		size_t count = table.Count.load(
+			std::memory_order_relaxed
+		);
+		size_t index = 0ULL;
+		while (index < count)
+		{
+			_Category& category = table.Categories[index];
+			uint8_t level = category.Level.load(std::memory_order_relaxed);
+			uint8_t sinks = category.Sinks.load(std::memory_order_relaxed);
+			if (level == _Category::Inherit
+				&& index > 0ULL)
 			{
-				return LogLevel(
-					LogSeverity::Critical
-				);
+				level = table.Categories[category.Parent].EffectiveLevel.load(std::memory_order_relaxed);
 			}
-			else
+
+			if (sinks == _Category::Inherit)
 			{
-				return LogLevel(
-					LogSeverity::Disabled
-				);
+				sinks = index > 0ULL ? table.Categories[category.Parent].EffectiveSinks.load(std::memory_order_relaxed) : CategorySinks::All;
 			}
-		};
-
-		constexpr LogLevel() :
-			m_Value(LogSeverity::Disabled)
-		{ };
-
-		constexpr LogLevel(
-			LogSeverity value
-		) : m_Value(value)
-		{ };
 
-		~LogLevel() = default;
+			category.EffectiveLevel.store(
+				level,
+				std::memory_order_relaxed
+			);
+			category.EffectiveSinks.store(
+				sinks,
+				std::memory_order_relaxed
+			);
+			index += 1ULL;
+		}
+	};
 
-		constexpr operator LogSeverity() const
+	/**
+	* @brief Helper for categories. Finds or adds the category while the table is locked. Standalone use not supported.
+	* @return The index of the category or 0 if the table is full or the name is too long.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline size_t _RegisterCategory(
+		_CategoryTable& table,
+		std::string_view name,
+		uint64_t hash
+	) {
+		if (name.empty() == true
+			|| name.size() > _Category::MaximumNameLength)
 		{
-			return m_Value;
+			return 0ULL;
 		}
 
-		constexpr bool operator<(
-			LogLevel other
-		) const {
-			return static_cast<uint8_t>(m_Value) < static_cast<uint8_t>(other.m_Value);
-		};
-
-		constexpr bool operator>(
-			LogLevel other
-		) const {
-			return static_cast<uint8_t>(m_Value) > static_cast<uint8_t>(other.m_Value);
-		};
+		size_t count = table.Count.load(
+			std::memory_order_relaxed
+		);
+		size_t index = 1ULL;
+		while (index < count)
+		{
+			const _Category& category = table.Categories[index];
+			if (category.Hash == hash
+				&& std::string_view(category.Name.data(), category.NameLength) == name)
+			{
+				return index;
+			}
 
-		constexpr bool operator<=(
-			LogLevel other
-		) const {
-			return static_cast<uint8_t>(m_Value) <= static_cast<uint8_t>(other.m_Value);
-		};
+			index += 1ULL;
+		}
 
-		constexpr bool operator>=(
-			LogLevel other
-		) const {
-			return static_cast<uint8_t>(m_Value) >= static_cast<uint8_t>(other.m_Value);
-		};
+		// "net.http" inherits from "net"
+		size_t parent = 0ULL;
+		size_t separator = name.find_last_of(
+			'.'
+		);
+		if (separator != std::string_view::npos)
+		{
+			std::string_view parentName = name.substr(
+				0ULL,
+				separator
+			);
+			parent = _RegisterCategory(
+				table,
+				parentName,
+				HashCategory(parentName)
+			);
+			count = table.Count.load(
+				std::memory_order_relaxed
+			);
+		}
 
-		constexpr bool operator==(
-			LogLevel other
-		) const {
-			return static_cast<uint8_t>(m_Value) == static_cast<uint8_t>(other.m_Value);
-		};
+		if (count >= _CategoryTable::Capacity)
+		{
+			return 0ULL;
+		}
 
-		constexpr bool operator!=(
-			LogLevel other
-		) const {
-			return static_cast<uint8_t>(m_Value) != static_cast<uint8_t>(other.m_Value);
-		};
+		_Category& category = table.Categories[count];
+		category.Hash = hash;
+		std::memcpy(
+			category.Name.data(),
+			name.data(),
+			name.size()
+		);
+		category.NameLength = name.size();
+		category.Parent = parent;
+		category.EffectiveLevel.store(
+			table.Categories[parent].EffectiveLevel.load(std::memory_order_relaxed),
+			std::memory_order_relaxed
+		);
+		category.EffectiveSinks.store(
+			table.Categories[parent].EffectiveSinks.load(std::memory_order_relaxed),
+			std::memory_order_relaxed
+		);
+		table.Count.store(
+			count + 1ULL,
+			std::memory_order_release
+		);
+		return count;
+	};
 
-		/**
-		* @brief Parse this instance to it's string representation.
-		* @return The value of this instance represented as a string.
-		* @author Narumikazuchi
-		* @date 13.01.2025
-		*/
-		inline const std::string& ToString() const
+	#ifdef SIMPLELOG_DEFINE_BACKEND
+	/**
+	* @brief Registers a category (and its parents) if it does not exist yet. The logging macros call this once per call site.
+	* @param name The name of the category; a '.' separates it from its parent (e.g. "net.http").
+	* @param hash The hash of the name (`HashCategory`).
+	* @return The index of the category.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API size_t RegisterCategory(
+		std::string_view name,
+		uint64_t hash
+	) {
+		_CategoryTable& table = _Categories();
+		std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+			table.Mutex
+		);
+		return _RegisterCategory(
+			table,
+			name,
+			hash
+		);
+	};
+	#endif // SIMPLELOG_DEFINE_BACKEND
+
+	/**
+	* @brief Sets the level of a category. Categories below it that have no level of their own inherit it.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void SetCategoryLevel(
+		std::string_view name,
+		LogLevel level
+	) {
+		_CategoryTable& table = _Categories();
+		std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+			table.Mutex
+		);
+		size_t index = _RegisterCategory(
+			table,
+			name,
+			HashCategory(name)
+		);
+		if (index == 0ULL)
+		{
+			return;
+		}
+
+		table.Categories[index].Level.store(
+			static_cast<uint8_t>(static_cast<LogSeverity>(level)),
+			std::memory_order_relaxed
+		);
+		_RefreshCategories(
+			table
+		);
+		_InvalidateCallSites();
+	};
+
+	/**
+	* @brief Removes the level of a category, so it inherits the level of its parent again.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void ResetCategoryLevel(
+		std::string_view name
+	) {
+		_CategoryTable& table = _Categories();
+		std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+			table.Mutex
+		);
+		size_t index = _RegisterCategory(
+			table,
+			name,
+			HashCategory(name)
+		);
+		if (index == 0ULL)
+		{
+			return;
+		}
+
+		table.Categories[index].Level.store(
+			_Category::Inherit,
+			std::memory_order_relaxed
+		);
+		_RefreshCategories(
+			table
+		);
+		_InvalidateCallSites();
+	};
+
+	/**
+	* @brief Sets the outputs a category writes to (see `CategorySinks`). Outputs that are disabled in the configuration stay disabled.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void SetCategorySinks(
+		std::string_view name,
+		uint8_t sinks
+	) {
+		_CategoryTable& table = _Categories();
+		std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+			table.Mutex
+		);
+		size_t index = _RegisterCategory(
+			table,
+			name,
+			HashCategory(name)
+		);
+		if (index == 0ULL)
+		{
+			return;
+		}
+
+		table.Categories[index].Sinks.store(
+			static_cast<uint8_t>(sinks & CategorySinks::All),
+			std::memory_order_relaxed
+		);
+		_RefreshCategories(
+			table
+		);
+	};
+
+	/**
+	* @brief Helper for filters. Compiles a filter spec like "*=warning,Server.cpp=debug,HandleRequest=trace" into rules. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline std::vector<_FilterRule> _CompileFilter(
+		std::string_view spec
+	) {
+		std::vector<_FilterRule> rules = std::vector<_FilterRule>();
+		auto trim = [](std::string_view value) -> std::string_view
 		{
-			static const std::string trace = std::string("Trace");
-			static const std::string debug = std::string("Debug");
-			static const std::string information = std::string("Information");
-			static const std::string warning = std::string("Warning");
-			static const std::string error = std::string("Error");
-			static const std::string critical = std::string("Critical");
-			static const std::string unknown = std::string("Unknown");
-			switch (m_Value)
+			size_t begin = value.find_first_not_of(" \t");
+			if (begin == std::string_view::npos)
 			{
-				case LogSeverity::Trace:
-				{
-					return trace;
-				}
-				case LogSeverity::Debug:
-				{
-					return debug;
-				}
-				case LogSeverity::Information:
-				{
-					return information;
-				}
-				case LogSeverity::Warning:
-				{
-					return warning;
-				}
-				case LogSeverity::Error:
-				{
-					return error;
-				}
-				case LogSeverity::Critical:
+				return std::string_view();
+			}
+
+			size_t end = value.find_last_not_of(" \t");
+			return value.substr(begin, end - begin + 1ULL);
+		};
+
+		while (spec.empty() == false)
+		{
+			size_t comma = spec.find(
+				','
+			);
+			std::string_view entry = trim(spec.substr(0ULL, comma));
+			spec = comma == std::string_view::npos ? std::string_view() : spec.substr(comma + 1ULL);
+			if (entry.empty() == true)
+			{
+				continue;
+			}
+
+			// A level without a pattern applies to everything
+			size_t equals = entry.find(
+				'='
+			);
+			std::string_view pattern = equals == std::string_view::npos ? std::string_view("*") : trim(entry.substr(0ULL, equals));
+			std::string_view level = equals == std::string_view::npos ? entry : trim(entry.substr(equals + 1ULL));
+
+			_FilterRule rule = _FilterRule();
+			rule.Level = LogLevel::Parse(
+				level
+			);
+			if (rule.Level == LogLevels::Disabled)
+			{
+				std::string lowered = std::string();
+				for (char character : level)
 				{
-					return critical;
+					lowered.push_back(
+						static_cast<char>(std::tolower(static_cast<unsigned char>(character)))
+					);
 				}
-				default:
+
+				if (lowered != "off"
+					&& lowered != "disabled")
 				{
-					return unknown;
+					throw std::invalid_argument(
+						"Unknown level in filter spec."
+					);
 				}
 			}
+
+			if (pattern != "*")
+			{
+				rule.Pattern = pattern;
+			}
+
+			rules.push_back(
+				rule
+			);
+		}
+
+		return rules;
+	};
+
+	/**
+	* @brief Helper for filters. Keeps the rules for good, a spec that was kept before is reused. The filter has to be locked. Standalone use not supported.
+	* @return The rules to publish with the settings or nullptr if there are none.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline const std::vector<_FilterRule>* _PublishFilterRules(
+		_Filter& filter,
+		std::vector<_FilterRule>&& rules
+	) {
+		if (rules.empty() == true)
+		{
+			return nullptr;
+		}
+
+		const std::vector<_FilterRule>* published = nullptr;
+		for (const std::vector<_FilterRule>& candidate : filter.Published)
+		{
+			if (candidate == rules)
+			{
+				published = &candidate;
+				break;
+			}
+		}
+
+		// The elements of a deque never move
+		if (published == nullptr)
+		{
+			filter.Published.push_back(
+				std::move(rules)
+			);
+			published = &filter.Published.back();
+		}
+
+		return published;
+	};
+
+	/**
+	* @brief Helper for the configuration. Everything that decides the level of a message without a call site, published as a single immutable snapshot. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _Settings final
+	{
+	public:
+		LoggerConfiguration Configuration = LoggerConfiguration();
+		const std::vector<_FilterRule>* Rules = nullptr;	///< The filter, nullptr if there is none.
+		uint8_t RootLevel = _Category::Inherit;				///< The effective level of the messages without a category.
+	};
+
+	/**
+	* @brief Helper for the configuration. Every snapshot that has been published; a snapshot is never changed or freed, so readers hold on to it without a lock. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _SettingsHistory final
+	{
+	public:
+		_SettingsHistory()
+		{
+			this->Published.emplace_back();
+			this->Current.store(
+				&this->Published.back(),
+				std::memory_order_release
+			);
 		};
 
-	private:
-		LogSeverity m_Value;
+		std::deque<_Settings> Published = std::deque<_Settings>();
+		std::atomic<const _Settings*> Current = nullptr;
 	};
 
-	namespace LogLevels
+	/**
+	* @brief Helper for the configuration. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline _SettingsHistory& _PublishedSettings()
 	{
-		/**
-		* @brief Logging is disabled.
-		*/
-		inline constexpr LogLevel Disabled = LogLevel(LogSeverity::Disabled);
-		/**
-		* @brief Critical errors that will crash the application.
-		*/
-		inline constexpr LogLevel Critical = LogLevel(LogSeverity::Critical);
-		/**
-		* @brief Errors that keep a feature from functioning, but do not crash the entire application.
-		*/
-		inline constexpr LogLevel Error = LogLevel(LogSeverity::Error);
-		/**
-		* @brief Warnings that indicate potential problems.
-		*/
-		inline constexpr LogLevel Warning = LogLevel(LogSeverity::Warning);
-		/**
-		* @brief Informational messages to provide context or status updates.
-		*/
-		inline constexpr LogLevel Information = LogLevel(LogSeverity::Information);
-		/**
-		* @brief Detailed debugging information (only used during development).
-		*/
-		inline constexpr LogLevel Debug = LogLevel(LogSeverity::Debug);
-		/**
-		* @brief Information detailing the order of events in the entire application.
-		*/
-		inline constexpr LogLevel Trace = LogLevel(LogSeverity::Trace);
+		static _SettingsHistory history = _SettingsHistory();
+
+		return history;
 	}
 
 	/**
-	* @brief Provides all configuration valus that influence the logger.
+	* @brief Helper for the configuration. The snapshot of the settings that is currently in effect. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline const _Settings& _CurrentSettings()
+	{
+		return *_PublishedSettings().Current.load(
+			std::memory_order_acquire
+		);
+	};
+
+	/**
+	* @brief Gets the current configuration for the logger. The configuration is an immutable snapshot that stays valid for the lifetime of the process; use `ConfigureLogger` to change it.
 	* @author Narumikazuchi
 	* @date 01.07.2025
 	*/
-	struct LoggerConfiguration final
+	inline const LoggerConfiguration& CurrentConfiguration()
+	{
+		return _CurrentSettings().Configuration;
+	}
+
+	/**
+	* @brief Helper for the configuration. Publishes the configuration, the filter and the level of the root category as one snapshot and makes every call site resolve its level again. The filter has to be locked and the root category has to be refreshed. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _PublishSettings(
+		const LoggerConfiguration& configuration,
+		const std::vector<_FilterRule>* rules
+	) {
+		_SettingsHistory& history = _PublishedSettings();
+		_Settings& settings = history.Published.emplace_back();
+		settings.Configuration = configuration;
+		settings.Rules = rules;
+		settings.RootLevel = _Categories().Categories[0].EffectiveLevel.load(
+			std::memory_order_relaxed
+		);
+		history.Current.store(
+			&settings,
+			std::memory_order_release
+		);
+		_InvalidateCallSites();
+	};
+
+	/**
+	* @brief Helper for filters. Runs the rules against a call site, the last matching rule wins, and falls back to the level of the category. Standalone use not supported.
+	* @return The level or `_Category::Inherit` for the global `Severity`.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline uint8_t _ResolveSeverity(
+		const std::vector<_FilterRule>* rules,
+		std::string_view module,
+		std::string_view function,
+		size_t category,
+		uint8_t categoryLevel
+	) {
+		const _Category& entry = _Categories().Categories[category];
+		std::string_view name = std::string_view(entry.Name.data(), entry.NameLength);
+		size_t separator = module.find_last_of(
+			"/\\"
+		);
+		if (separator != std::string_view::npos)
+		{
+			module = module.substr(
+				separator + 1ULL
+			);
+		}
+
+		uint8_t result = _Filter::NoRule;
+		if (rules != nullptr)
+		{
+			for (const _FilterRule& rule : *rules)
+			{
+				// A category also matches the categories below it
+				std::string_view pattern = rule.Pattern;
+				if (pattern.empty() == true
+					|| pattern == module
+					|| pattern == function
+					|| (name.starts_with(pattern) == true
+						&& (name.size() == pattern.size()
+							|| name[pattern.size()] == '.')))
+				{
+					result = static_cast<uint8_t>(static_cast<LogSeverity>(rule.Level));
+				}
+			}
+		}
+
+		if (result == _Filter::NoRule)
+		{
+			result = categoryLevel;
+		}
+
+		return result;
+	};
+
+	inline std::atomic<_FlightRecorder*>& _ActiveFlightRecorder();
+	inline std::atomic<_BacktraceRing*>& _ActiveBacktrace();
+
+	/**
+	* @brief Helper for filters. Gets the most detailed level a call site writes.
+	*
+	* The level is resolved from the filter and the category without a lock and cached in the call site, tagged with the generation of the settings. The cached decision also covers the state of the call site and whether messages are captured, so the caller can discard a message without calling into the logger (see `_Discards`). Changing any of them starts a new generation once everything is applied; a decision made while the settings change still carries the old generation and is made again on the next message.
+	*
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline LogLevel _SiteSeverity(
+		const CallSite* site,
+		std::string_view module,
+		std::string_view function
+	) {
+		// Everything comes from one snapshot, so a message never sees half of a new configuration
+		if (site == nullptr)
+		{
+			const _Settings& settings = _CurrentSettings();
+			uint8_t decision = settings.RootLevel;
+			if (settings.Rules != nullptr)
+			{
+				decision = _ResolveSeverity(
+					settings.Rules,
+					module,
+					function,
+					0ULL,
+					settings.RootLevel
+				);
+			}
+
+			if (decision == _Category::Inherit)
+			{
+				return settings.Configuration.Severity;
+			}
+
+			return LogLevel(static_cast<LogSeverity>(decision));
+		}
+
+		// The resolved level is stored next to the generation it was made in
+		uint64_t generation = _SettingsGeneration().load(std::memory_order_acquire);
+		uint64_t cached = site->Filter.load(std::memory_order_relaxed);
+		if ((cached >> 8U) == generation)
+		{
+			return LogLevel(static_cast<LogSeverity>(cached & (_CallSiteCapture - 1ULL)));
+		}
+
+		const _Settings& settings = _CurrentSettings();
+		uint8_t decision = _ResolveSeverity(
+			settings.Rules,
+			module,
+			function,
+			site->Category,
+			_Categories().Categories[site->Category].EffectiveLevel.load(std::memory_order_relaxed)
+		);
+		if (decision == _Category::Inherit)
+		{
+			decision = static_cast<uint8_t>(static_cast<LogSeverity>(settings.Configuration.Severity));
+		}
+
+		switch (site->State.load(std::memory_order_relaxed))
+		{
+			case CallSiteState::Enabled:
+			{
+				decision = static_cast<uint8_t>(LogSeverity::Trace);
+				break;
+			}
+			case CallSiteState::Disabled:
+			{
+				decision = static_cast<uint8_t>(LogSeverity::Disabled);
+				break;
+			}
+			default:
+			{
+				break;
+			}
+		}
+
+		uint64_t capture = _ActiveFlightRecorder().load(std::memory_order_relaxed) != nullptr
+						   || _ActiveBacktrace().load(std::memory_order_relaxed) != nullptr ? _CallSiteCapture : 0ULL;
+		site->Filter.store(
+			(generation << 8U) | capture | decision,
+			std::memory_order_relaxed
+		);
+		return LogLevel(static_cast<LogSeverity>(decision));
+	};
+
+	/**
+	* @brief The description of a registered call site, as returned by `ListCallSites`.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct CallSiteInfo final
 	{
 	public:
-		std::filesystem::path LogDirectory	= std::filesystem::path();
-		LogLevel Severity					= LogLevels::Warning;
-		std::string FileNamePrefix			= std::string();
-		std::string FileNamePostfix			= std::string();
-		bool WriteThreadId					= false;
-		bool WriteToConsole					= false;
-		bool WriteToFile					= true;
+		std::string_view Module = std::string_view();
+		std::string_view Line = std::string_view();
+		std::string_view Function = std::string_view();
+		std::string_view Template = std::string_view();
+		std::string_view Category = std::string_view();
+		LogLevel Level = LogLevels::Disabled;
+		CallSiteState State = CallSiteState::Default;
+		uint64_t Hits = 0ULL;			///< How many messages passed the level check.
+		uint64_t Bytes = 0ULL;
+		uint64_t Nanoseconds = 0ULL;
+	};
+
+	/**
+	* @brief Lists every call site that has been reached at least once, most recently registered first.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline std::vector<CallSiteInfo> ListCallSites()
+	{
+		std::vector<CallSiteInfo> sites = std::vector<CallSiteInfo>();
+		const CallSite* site = _LastCallSite().load(
+			std::memory_order_acquire
+		);
+		while (site != nullptr)
+		{
+			const _Category& category = _Categories().Categories[site->Category];
+			CallSiteInfo info = CallSiteInfo();
+			info.Module = site->Module;
+			info.Line = site->Line;
+			info.Function = site->Function;
+			info.Template = site->Template;
+			info.Category = std::string_view(category.Name.data(), category.NameLength);
+			info.Level = site->Level;
+			info.State = site->State.load(std::memory_order_relaxed);
+			info.Hits = site->Hits.load(std::memory_order_relaxed);
+			info.Bytes = site->Bytes.load(std::memory_order_relaxed);
+			info.Nanoseconds = site->Nanoseconds.load(std::memory_order_relaxed);
+			sites.push_back(
+				info
+			);
+			site = site->Previous;
+		}
+
+		return sites;
+	};
+
+	/**
+	* @brief What the call sites of a profile report are ranked by.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	enum class ProfileOrder : uint8_t
+	{
+		Bytes,	///< The bytes written by the call site.
+		Time,	///< The time spent writing the records of the call site.
+		Hits,	///< How often the call site was reached.
+	};
+
+	/**
+	* @brief Gets the call sites that cost the most. Bytes and time are only measured while `ProfileCallSites` is enabled.
+	* @param count The maximum number of call sites.
+	* @param order What the call sites are ranked by.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline std::vector<CallSiteInfo> TopCallSites(
+		size_t count,
+		ProfileOrder order = ProfileOrder::Bytes
+	) {
+		std::vector<CallSiteInfo> sites = ListCallSites();
+		auto cost = [order](const CallSiteInfo& site) -> uint64_t
+		{
+			switch (order)
+			{
+				case ProfileOrder::Time:
+				{
+					return site.Nanoseconds;
+				}
+				case ProfileOrder::Hits:
+				{
+					return site.Hits;
+				}
+				default:
+				{
+					return site.Bytes;
+				}
+			}
+		};
+
+		count = std::min<size_t>(
+			count,
+			sites.size()
+		);
+		std::partial_sort(
+			sites.begin(),
+			sites.begin() + count,
+			sites.end(),
+			[&cost](const CallSiteInfo& left, const CallSiteInfo& right)
+			{
+				return cost(left) > cost(right);
+			}
+		);
+		sites.resize(
+			count
+		);
+		return sites;
+	};
+
+	/**
+	* @brief Writes a table of the call sites that cost the most (see `TopCallSites`).
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void WriteProfileReport(
+		std::ostream& output,
+		size_t count = 5ULL,
+		ProfileOrder order = ProfileOrder::Bytes
+	) {
+		output << "hits\tbytes\ttime_us\tlocation\ttemplate\n";
+		for (const CallSiteInfo& site : TopCallSites(count, order))
+		{
+			output << site.Hits << '\t' << site.Bytes << '\t' << site.Nanoseconds / 1000ULL << '\t' << site.Module << ':' << site.Line << '\t' << site.Template << '\n';
+		}
+	};
+
+	/**
+	* @brief Overrides the level check of call sites at runtime, e.g. to enable a single Trace message without changing `Severity`.
+	* @param location Either "file:line", a file name (every call site inside it) or a function name; files are given without their directory.
+	* @return The number of call sites that were changed. Call sites that have not been reached yet are not known.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline size_t SetCallSiteState(
+		std::string_view location,
+		CallSiteState state
+	) {
+		size_t changed = 0ULL;
+		const CallSite* site = _LastCallSite().load(
+			std::memory_order_acquire
+		);
+		while (site != nullptr)
+		{
+			std::string_view module = site->Module;
+			size_t separator = module.find_last_of(
+				"/\\"
+			);
+			if (separator != std::string_view::npos)
+			{
+				module = module.substr(
+					separator + 1ULL
+				);
+			}
+
+			bool matches = location == module
+						   || location == site->Function;
+			if (matches == false
+				&& location.size() == module.size() + 1ULL + site->Line.size()
+				&& location.starts_with(module) == true
+				&& location[module.size()] == ':'
+				&& location.ends_with(site->Line) == true)
+			{
+				matches = true;
+			}
+
+			if (matches == true)
+			{
+				site->State.store(
+					state,
+					std::memory_order_relaxed
+				);
+				changed += 1ULL;
+			}
+
+			site = site->Previous;
+		}
+
+		// The state is part of the cached decision of a call site
+		if (changed > 0ULL)
+		{
+			_InvalidateCallSites();
+		}
+
+		return changed;
+	};
+
+	/**
+	* @brief Callback that drains buffered log data into the given file descriptor while the process is crashing.
+	*
+	* A drain runs inside a fatal signal handler. It must only use async-signal-safe calls (like `write`) and must never take a lock, allocate or throw.
+	*
+	* @param fileDescriptor The descriptor the buffered data should be written to.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	using CrashDrain = void (*)(int fileDescriptor);
+
+	/**
+	* @brief Helper for the crash handler. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline std::array<std::atomic<CrashDrain>, 16ULL>& _CrashDrains()
+	{
+		static std::array<std::atomic<CrashDrain>, 16ULL> drains = { };
+
+		return drains;
+	}
+
+	/**
+	* @brief Registers a drain that will be invoked when a fatal signal is received and `FlushOnCrash` is enabled.
+	* @param drain The drain to register.
+	* @return True if the drain was registered; false if all slots are taken.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline bool RegisterCrashDrain(
+		CrashDrain drain
+	) {
+		for (std::atomic<CrashDrain>& slot : _CrashDrains())
+		{
+			CrashDrain expected = nullptr;
+			if (slot.load(std::memory_order_acquire) == drain)
+			{
+				return true;
+			}
+
+			if (slot.compare_exchange_strong(expected, drain, std::memory_order_acq_rel) == true)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	};
+
+	/**
+	* @brief Removes a previously registered crash drain.
+	* @param drain The drain to remove.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void UnregisterCrashDrain(
+		CrashDrain drain
+	) {
+		for (std::atomic<CrashDrain>& slot : _CrashDrains())
+		{
+			CrashDrain expected = drain;
+			slot.compare_exchange_strong(
+				expected,
+				nullptr,
+				std::memory_order_acq_rel
+			);
+		}
+	};
+
+	/**
+	* @brief The targets the crash handler writes to. Published by the logger without locks so the signal handler can read them.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _CrashTarget final
+	{
+	public:
+		static constexpr size_t MaximumPathLength = 4096ULL;
+
+		char Paths[2][MaximumPathLength] = { };
+		std::atomic<int> ActivePath = -1;
+		std::mutex Publishing = std::mutex();	///< Held by the thread that fills the inactive path; the signal handler never takes it.
+		std::atomic<bool> WriteToConsole = false;
+	};
+
+	/**
+	* @brief Helper for the crash handler. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline _CrashTarget& _CurrentCrashTarget()
+	{
+		static _CrashTarget target = _CrashTarget();
+
+		return target;
+	}
+
+	/**
+	* @brief Publishes the log file that is currently written, so the crash handler knows where to drain to.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _PublishCrashFile(
+		const std::filesystem::path& filePath
+	) {
+		thread_local std::filesystem::path lastPublished = std::filesystem::path();
+		if (lastPublished == filePath)
+		{
+			return;
+		}
+
+		const std::string& native = filePath.native();
+		if (native.size() >= _CrashTarget::MaximumPathLength)
+		{
+			return;
+		}
+
+		// Only one thread fills the inactive path at a time and it becomes active once it is complete
+		_CrashTarget& target = _CurrentCrashTarget();
+		std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+			target.Publishing
+		);
+		int inactive = target.ActivePath.load(std::memory_order_relaxed) == 0 ? 1 : 0;
+		std::copy(
+			native.begin(),
+			native.end(),
+			target.Paths[inactive]
+		);
+		target.Paths[inactive][native.size()] = 0;
+		target.ActivePath.store(
+			inactive,
+			std::memory_order_release
+		);
+		lastPublished = filePath;
+	};
+
+#ifdef __linux__
+	/**
+	* @brief Helper for the crash handler. Writes the whole buffer using only async-signal-safe calls.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _WriteAll(
+		int fileDescriptor,
+		const char* data,
+		size_t size
+	) {
+		while (size > 0ULL)
+		{
+			ssize_t written = ::write(
+				fileDescriptor,
+				data,
+				size
+			);
+			if (written < 0
+				&& errno == EINTR)
+			{
+				continue;
+			}
+
+			if (written <= 0)
+			{
+				return;
+			}
+
+			data += written;
+			size -= static_cast<size_t>(written);
+		}
+	};
+
+	/**
+	* @brief Helper for the crash handler. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline std::array<int, 5ULL>& _CrashSignals()
+	{
+		static std::array<int, 5ULL> signals = { SIGSEGV, SIGABRT, SIGBUS, SIGFPE, SIGILL };
+
+		return signals;
+	}
+
+	/**
+	* @brief Helper for the crash handler. Stores the handlers that were installed before ours.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline std::array<struct sigaction, 5ULL>& _PreviousCrashActions()
+	{
+		static std::array<struct sigaction, 5ULL> actions = { };
+
+		return actions;
+	}
+
+	/**
+	* @brief Helper for the crash handler. Writes the drained buffers and a closing record to the given descriptor.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _DrainInto(
+		int fileDescriptor,
+		int signal
+	) {
+		for (std::atomic<CrashDrain>& slot : _CrashDrains())
+		{
+			CrashDrain drain = slot.load(std::memory_order_acquire);
+			if (drain != nullptr)
+			{
+				drain(fileDescriptor);
+			}
+		}
+
+		// Signal number without snprintf, which is not async-signal-safe
+		char number[8] = { };
+		size_t digits = 0ULL;
+		int value = signal;
+		do
+		{
+			number[sizeof(number) - 1ULL - digits] = static_cast<char>('0' + value % 10);
+			value /= 10;
+			digits += 1ULL;
+		}
+		while (value > 0
+			   && digits < sizeof(number));
+
+		static constexpr char prefix[] = "--:--:--\t\t[Critical    ]\t\tFatal signal ";
+		static constexpr char postfix[] = " received, buffered log records have been drained.\n";
+		_WriteAll(
+			fileDescriptor,
+			prefix,
+			sizeof(prefix) - 1ULL
+		);
+		_WriteAll(
+			fileDescriptor,
+			number + sizeof(number) - digits,
+			digits
+		);
+		_WriteAll(
+			fileDescriptor,
+			postfix,
+			sizeof(postfix) - 1ULL
+		);
+	};
+
+	/**
+	* @brief The fatal signal handler. Drains all registered buffers, restores the previous handler and re-raises the signal.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _CrashSignalHandler(
+		int signal
+	) {
+		static std::atomic<bool> handling = false;
+		if (handling.exchange(true) == false)
+		{
+			_CrashTarget& target = _CurrentCrashTarget();
+			if (target.WriteToConsole.load(std::memory_order_acquire) == true)
+			{
+				_DrainInto(
+					STDOUT_FILENO,
+					signal
+				);
+			}
+
+			int active = target.ActivePath.load(std::memory_order_acquire);
+			if (active >= 0)
+			{
+				int fileDescriptor = ::open(
+					target.Paths[active],
+					O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC,
+					0644
+				);
+				if (fileDescriptor >= 0)
+				{
+					_DrainInto(
+						fileDescriptor,
+						signal
+					);
+					::fsync(
+						fileDescriptor
+					);
+					::close(
+						fileDescriptor
+					);
+				}
+			}
+		}
+
+		// Hand the signal to whoever was installed before us (or the default action)
+		size_t index = 0ULL;
+		while (index < _CrashSignals().size())
+		{
+			if (_CrashSignals()[index] == signal)
+			{
+				::sigaction(
+					signal,
+					&_PreviousCrashActions()[index],
+					nullptr
+				);
+				break;
+			}
+
+			index += 1ULL;
+		}
+
+		::raise(
+			signal
+		);
+	};
+#endif // __linux__
+
+#ifdef __linux__
+	/**
+	* @brief Helper for the crash handler. Set while the handler is installed, so threads that start logging afterwards install an alternate stack of their own. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline std::atomic<bool>& _CrashHandlerInstalled()
+	{
+		static std::atomic<bool> installed = false;
+
+		return installed;
+	}
+
+	/**
+	* @brief Helper for the crash handler. The alternate signal stack of a thread; a signal is handled on the thread that caused it, so a stack overflow can only be reported if that thread has one. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _AlternateSignalStack final
+	{
+	public:
+		static constexpr size_t Size = 65536ULL;
+
+		std::unique_ptr<char[]> Memory = nullptr;
+
+		/**
+		* @brief Installs the stack, unless the thread already has one (its own or one of the application).
+		*/
+		inline void Install()
+		{
+			stack_t current = stack_t();
+			if (this->Memory != nullptr
+				|| ::sigaltstack(nullptr, &current) != 0
+				|| (current.ss_flags & SS_DISABLE) == 0)
+			{
+				return;
+			}
+
+			this->Memory = std::make_unique<char[]>(
+				_AlternateSignalStack::Size
+			);
+			stack_t stack = stack_t();
+			stack.ss_sp = this->Memory.get();
+			stack.ss_size = _AlternateSignalStack::Size;
+			stack.ss_flags = 0;
+			if (::sigaltstack(&stack, nullptr) != 0)
+			{
+				this->Memory = nullptr;
+			}
+		};
+
+		~_AlternateSignalStack()
+		{
+			// The memory is freed with the thread, so the stack must not outlive it
+			stack_t current = stack_t();
+			if (this->Memory == nullptr
+				|| ::sigaltstack(nullptr, &current) != 0
+				|| current.ss_sp != this->Memory.get())
+			{
+				return;
+			}
+
+			stack_t stack = stack_t();
+			stack.ss_flags = SS_DISABLE;
+			::sigaltstack(
+				&stack,
+				nullptr
+			);
+		};
+	};
+
+	/**
+	* @brief Helper for the crash handler. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline _AlternateSignalStack& _CurrentSignalStack()
+	{
+		thread_local _AlternateSignalStack stack = _AlternateSignalStack();
+
+		return stack;
+	}
+#endif // __linux__
+
+	/**
+	* @brief Installs or removes the fatal signal handler that drains buffered log records.
+	* @param install Whether the handler should be installed or removed.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _ConfigureCrashHandler(
+		bool install
+	) {
+	#ifdef __linux__
+		static bool installed = false;
+		if (install == installed)
+		{
+			return;
+		}
+
+		if (install == true)
+		{
+			// A stack overflow can only be reported from an alternate stack; every other thread installs its own once it logs
+			_CrashHandlerInstalled().store(
+				true,
+				std::memory_order_release
+			);
+			_CurrentSignalStack().Install();
+
+			struct sigaction action = { };
+			action.sa_handler = &_CrashSignalHandler;
+			action.sa_flags = SA_ONSTACK;
+			::sigemptyset(
+				&action.sa_mask
+			);
+
+			size_t index = 0ULL;
+			while (index < _CrashSignals().size())
+			{
+				::sigaction(
+					_CrashSignals()[index],
+					&action,
+					&_PreviousCrashActions()[index]
+				);
+				index += 1ULL;
+			}
+		}
+		else
+		{
+			size_t index = 0ULL;
+			while (index < _CrashSignals().size())
+			{
+				::sigaction(
+					_CrashSignals()[index],
+					&_PreviousCrashActions()[index],
+					nullptr
+				);
+				index += 1ULL;
+			}
+
+			_CrashHandlerInstalled().store(
+				false,
+				std::memory_order_release
+			);
+		}
+
+		installed = install;
+	#endif // __linux__
+	};
+
+	/**
+	* @brief Layout of the first bytes of a flight recorder file.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _FlightRecorderHeader final
+	{
+	public:
+		static constexpr uint64_t ExpectedMagic = 0x32474E4952464C53ULL; // "SLFRING2"
+
+		uint64_t Magic;
+		uint64_t Capacity;
+		uint64_t Head;
+		uint64_t Reserved[5];
+	};
+
+	/**
+	* @brief A fixed-size circular buffer inside a memory-mapped file. Everything written to it survives a crash of the process.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _FlightRecorder final
+	{
+	public:
+		std::filesystem::path Path = std::filesystem::path();
+		char* Mapping = nullptr;
+		size_t Capacity = 0ULL;
+
+		/**
+		* @brief Copies a complete record (including its header) into the ring.
+		*
+		* The slot is reserved with a single atomic add. The record magic is cleared while the payload is copied and published last, so a record that was torn by a crash is recognized by the decoder.
+		*/
+		inline void Write(
+			const char* record,
+			size_t size
+		) {
+			_FlightRecorderHeader* header = reinterpret_cast<_FlightRecorderHeader*>(this->Mapping);
+			char* data = this->Mapping + sizeof(_FlightRecorderHeader);
+			uint64_t position = std::atomic_ref<uint64_t>(header->Head).fetch_add(
+				size,
+				std::memory_order_relaxed
+			);
+			size_t offset = static_cast<size_t>(position % this->Capacity);
+
+			// Magic and size never wrap, since records and the capacity are multiples of 8
+			uint64_t claim = 0ULL;
+			std::memcpy(
+				&claim,
+				record,
+				sizeof(uint64_t)
+			);
+			std::memset(
+				&claim,
+				0,
+				sizeof(uint32_t)
+			);
+			std::atomic_ref<uint64_t>(*reinterpret_cast<uint64_t*>(data + offset)).store(
+				claim,
+				std::memory_order_relaxed
+			);
+
+			size_t first = std::min<size_t>(
+				size,
+				this->Capacity - offset
+			);
+			std::memcpy(
+				data + offset + sizeof(uint64_t),
+				record + sizeof(uint64_t),
+				first - sizeof(uint64_t)
+			);
+			if (first < size)
+			{
+				std::memcpy(
+					data,
+					record + first,
+					size - first
+				);
+			}
+
+			std::atomic_ref<uint32_t>(*reinterpret_cast<uint32_t*>(data + offset)).store(
+				_BinaryRecordHeader::ExpectedMagic,
+				std::memory_order_release
+			);
+		};
+	};
+
+	/**
+	* @brief Helper for the flight recorder. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline std::atomic<_FlightRecorder*>& _ActiveFlightRecorder()
+	{
+		static std::atomic<_FlightRecorder*> recorder = nullptr;
+
+		return recorder;
+	}
+
+	/**
+	* @brief Maps the flight recorder file, or disables the flight recorder if the path is empty.
+	*
+	* A previous mapping is intentionally never unmapped, since other threads might still be writing into it.
+	*
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _ConfigureFlightRecorder(
+		const std::filesystem::path& path,
+		size_t size
+	) {
+		_FlightRecorder* current = _ActiveFlightRecorder().load(std::memory_order_acquire);
+		if (path.empty() == true)
+		{
+			_ActiveFlightRecorder().store(
+				nullptr,
+				std::memory_order_release
+			);
+			return;
+		}
+
+		// Round the ring up to whole pages
+		size_t capacity = std::max<size_t>(
+			size,
+			static_cast<size_t>(65536ULL)
+		);
+		capacity = (capacity + 4095ULL) & ~static_cast<size_t>(4095ULL);
+		if (current != nullptr
+			&& current->Path == path
+			&& current->Capacity == capacity)
+		{
+			return;
+		}
+
+	#ifdef __linux__
+		if (path.has_parent_path() == true
+			&& std::filesystem::exists(path.parent_path()) == false)
+		{
+			std::filesystem::create_directories(
+				path.parent_path()
+			);
+		}
+
+		int fileDescriptor = ::open(
+			path.c_str(),
+			O_RDWR | O_CREAT | O_CLOEXEC,
+			0644
+		);
+		if (fileDescriptor < 0)
+		{
+			throw std::runtime_error(
+				"Could not open the flight recorder file."
+			);
+		}
+
+		size_t mappingSize = sizeof(_FlightRecorderHeader) + capacity;
+		void* mapping = MAP_FAILED;
+		if (::ftruncate(fileDescriptor, static_cast<off_t>(mappingSize)) == 0)
+		{
+			mapping = ::mmap(
+				nullptr,
+				mappingSize,
+				PROT_READ | PROT_WRITE,
+				MAP_SHARED,
+				fileDescriptor,
+				0
+			);
+		}
+
+		::close(
+			fileDescriptor
+		);
+		if (mapping == MAP_FAILED)
+		{
+			throw std::runtime_error(
+				"Could not map the flight recorder file."
+			);
+		}
+
+		// Keep the history of a previous run if the ring has the same size
+		_FlightRecorderHeader* header = static_cast<_FlightRecorderHeader*>(mapping);
+		if (header->Magic != _FlightRecorderHeader::ExpectedMagic
+			|| header->Capacity != capacity)
+		{
+			std::memset(
+				mapping,
+				0,
+				mappingSize
+			);
+			header->Capacity = capacity;
+			header->Magic = _FlightRecorderHeader::ExpectedMagic;
+		}
+
+		_FlightRecorder* recorder = new _FlightRecorder();
+		recorder->Path = path;
+		recorder->Mapping = static_cast<char*>(mapping);
+		recorder->Capacity = capacity;
+		_ActiveFlightRecorder().store(
+			recorder,
+			std::memory_order_release
+		);
+	#endif // __linux__
+	};
+
+	/**
+	* @brief A single slot of the backtrace ring. The sequence is odd while the slot is written; a writer claims the slot by making it odd.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct alignas(64) _BacktraceSlot final
+	{
+	public:
+		static constexpr size_t Capacity = 1024ULL;
+
+		std::atomic<uint64_t> Sequence = 0ULL;
+		uint32_t Size = 0U;
+		alignas(8) char Data[Capacity];
+	};
+
+	/**
+	* @brief An in-memory ring of the latest binary records that were discarded because of the configured severity.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _BacktraceRing final
+	{
+	public:
+		std::unique_ptr<_BacktraceSlot[]> Slots = nullptr;
+		size_t Count = 0ULL;
+		std::atomic<uint64_t> Next = 0ULL;
+		std::atomic<uint64_t> Dumped = 0ULL;
+
+		/**
+		* @brief Copies a record into the next slot, overwriting the oldest one. The record is dropped if the slot is still written or was already taken by a newer record.
+		*/
+		inline void Write(
+			const char* record,
+			size_t size
+		) {
+			if (size > _BacktraceSlot::Capacity)
+			{
+				return;
+			}
+
+			uint64_t index = this->Next.fetch_add(
+				1ULL,
+				std::memory_order_relaxed
+			);
+			_BacktraceSlot& slot = this->Slots[index % this->Count];
+
+			// Writers a whole ring apart map to the same slot; whoever does not get it drops the record instead of mixing both
+			uint64_t sequence = slot.Sequence.load(
+				std::memory_order_relaxed
+			);
+			if ((sequence & 1ULL) == 1ULL
+				|| sequence > index * 2ULL
+				|| slot.Sequence.compare_exchange_strong(
+					sequence,
+					index * 2ULL + 1ULL,
+					std::memory_order_acquire,
+					std::memory_order_relaxed
+				) == false)
+			{
+				return;
+			}
+
+			std::atomic_thread_fence(
+				std::memory_order_release
+			);
+			slot.Size = static_cast<uint32_t>(size);
+			std::memcpy(
+				slot.Data,
+				record,
+				size
+			);
+			slot.Sequence.store(
+				index * 2ULL + 2ULL,
+				std::memory_order_release
+			);
+		};
+
+		/**
+		* @brief Copies the record with the given index out of the ring. Returns 0 if the slot was overwritten or is still being written.
+		*/
+		inline size_t Read(
+			uint64_t index,
+			char* record
+		) const {
+			const _BacktraceSlot& slot = this->Slots[index % this->Count];
+			if (slot.Sequence.load(std::memory_order_acquire) != index * 2ULL + 2ULL)
+			{
+				return 0ULL;
+			}
+
+			size_t size = std::min<size_t>(
+				slot.Size,
+				_BacktraceSlot::Capacity
+			);
+			std::memcpy(
+				record,
+				slot.Data,
+				size
+			);
+			std::atomic_thread_fence(
+				std::memory_order_acquire
+			);
+			if (slot.Sequence.load(std::memory_order_relaxed) != index * 2ULL + 2ULL)
+			{
+				return 0ULL;
+			}
+
+			return size;
+		};
+
+		/**
+		* @brief Claims all records that have not been dumped yet. Every record is only handed out once.
+		*/
+		inline void Claim(
+			uint64_t& begin,
+			uint64_t& end
+		) {
+			end = this->Next.load(
+				std::memory_order_acquire
+			);
+			begin = this->Dumped.exchange(
+				end,
+				std::memory_order_acq_rel
+			);
+			if (begin > end)
+			{
+				begin = end;
+			}
+
+			if (end - begin > this->Count)
+			{
+				begin = end - this->Count;
+			}
+		};
+	};
+
+	/**
+	* @brief Helper for the backtrace ring. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline std::atomic<_BacktraceRing*>& _ActiveBacktrace()
+	{
+		static std::atomic<_BacktraceRing*> backtrace = nullptr;
+
+		return backtrace;
+	}
+
+#ifdef __linux__
+	/**
+	* @brief Helper for the crash handler. Collects small writes into one buffer, using only async-signal-safe calls.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _SignalSafeWriter final
+	{
+	public:
+		int FileDescriptor = -1;
+		char Buffer[1024] = { };
+		size_t Size = 0ULL;
+
+		inline void Append(
+			const char* data,
+			size_t size
+		) {
+			while (size > 0ULL)
+			{
+				if (this->Size == sizeof(this->Buffer))
+				{
+					this->Flush();
+				}
+
+				size_t length = std::min<size_t>(
+					size,
+					sizeof(this->Buffer) - this->Size
+				);
+				std::memcpy(
+					this->Buffer + this->Size,
+					data,
+					length
+				);
+				this->Size += length;
+				data += length;
+				size -= length;
+			}
+		};
+
+		inline void AppendUnsigned(
+			unsigned long long value
+		) {
+			char digits[24] = { };
+			size_t count = 0ULL;
+			do
+			{
+				digits[sizeof(digits) - 1ULL - count] = static_cast<char>('0' + value % 10ULL);
+				value /= 10ULL;
+				count += 1ULL;
+			}
+			while (value > 0ULL);
+
+			this->Append(
+				digits + sizeof(digits) - count,
+				count
+			);
+		};
+
+		inline void Flush()
+		{
+			_WriteAll(
+				this->FileDescriptor,
+				this->Buffer,
+				this->Size
+			);
+			this->Size = 0ULL;
+		};
+	};
+
+	/**
+	* @brief Helper for the crash handler. Writes a binary record as text without allocating. Timestamps are left out, since converting them is not async-signal-safe.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _WriteRecordSignalSafe(
+		_SignalSafeWriter& writer,
+		const char* record,
+		size_t size
+	) {
+		_BinaryRecordHeader header = _BinaryRecordHeader();
+		std::memcpy(
+			&header,
+			record,
+			sizeof(_BinaryRecordHeader)
+		);
+		size_t payloadSize = static_cast<size_t>(header.ModuleLength) + header.LineLength + header.FunctionLength + header.TemplateLength + header.ThreadLength + header.ArgumentsLength;
+		if (sizeof(_BinaryRecordHeader) + payloadSize > size)
+		{
+			return;
+		}
+
+		static constexpr const char* severities[] = { "Disabled    ", "Critical    ", "Error       ", "Warning     ", "Information ", "Debug       ", "Trace       " };
+		const char* payload = record + sizeof(_BinaryRecordHeader);
+		writer.Append("--:--:--\t\t[", 11ULL);
+		writer.Append(header.Level < 7U ? severities[header.Level] : "Unknown     ", 12ULL);
+		writer.Append("]\t\t", 3ULL);
+		writer.Append(payload, header.ModuleLength);
+		writer.Append(":", 1ULL);
+		writer.Append(payload + header.ModuleLength, header.LineLength);
+		writer.Append("\t\t", 2ULL);
+		payload += header.ModuleLength + header.LineLength;
+		writer.Append(payload, header.FunctionLength);
+		writer.Append("\t\t", 2ULL);
+		payload += header.FunctionLength;
+
+		const std::string_view text = std::string_view(payload, header.TemplateLength);
+		const char* arguments = payload + header.TemplateLength + header.ThreadLength;
+		const char* argumentsEnd = arguments + header.ArgumentsLength;
+		size_t position = 0ULL;
+		_TemplateToken token = _NextTemplateToken(
+			text,
+			position
+		);
+		while (token.Type != _TemplateToken::Kind::End)
+		{
+			if (token.Type == _TemplateToken::Kind::Text)
+			{
+				writer.Append(
+					text.data() + token.Begin,
+					token.Length
+				);
+			}
+			else
+			{
+				// Writes the next encoded argument in place of the placeholder
+				char tag = arguments < argumentsEnd ? *arguments : 0;
+				arguments += 1ULL;
+				while (tag == _EncodedArguments::NameTag
+					   && arguments < argumentsEnd)
+				{
+					arguments += 1ULL + static_cast<uint8_t>(*arguments);
+					tag = arguments < argumentsEnd ? *arguments : 0;
+					arguments += 1ULL;
+				}
+
+				if (tag == _EncodedArguments::StringTag
+					&& arguments + sizeof(uint32_t) <= argumentsEnd)
+				{
+					uint32_t length = 0U;
+					std::memcpy(&length, arguments, sizeof(uint32_t));
+					arguments += sizeof(uint32_t);
+					length = static_cast<uint32_t>(std::min<size_t>(length, static_cast<size_t>(argumentsEnd - arguments)));
+					writer.Append(arguments, length);
+					arguments += length;
+				}
+				else if ((tag == _EncodedArguments::SignedTag
+						  || tag == _EncodedArguments::UnsignedTag
+						  || tag == _EncodedArguments::FloatingTag)
+						 && arguments + sizeof(uint64_t) <= argumentsEnd)
+				{
+					unsigned long long magnitude = 0ULL;
+					unsigned long long fraction = 0ULL;
+					bool negative = false;
+					if (tag == _EncodedArguments::SignedTag)
+					{
+						long long value = 0LL;
+						std::memcpy(&value, arguments, sizeof(long long));
+						negative = value < 0LL;
+						magnitude = negative == true ? 0ULL - static_cast<unsigned long long>(value) : static_cast<unsigned long long>(value);
+					}
+					else if (tag == _EncodedArguments::UnsignedTag)
+					{
+						std::memcpy(&magnitude, arguments, sizeof(unsigned long long));
+					}
+					else
+					{
+						double value = 0.0;
+						std::memcpy(&value, arguments, sizeof(double));
+						negative = value < 0.0;
+						value = negative == true ? -value : value;
+						magnitude = value < 1.8e19 ? static_cast<unsigned long long>(value) : 0ULL;
+						fraction = static_cast<unsigned long long>((value - static_cast<double>(magnitude)) * 1000000.0 + 0.5);
+						if (fraction >= 1000000ULL)
+						{
+							magnitude += 1ULL;
+							fraction -= 1000000ULL;
+						}
+					}
+
+					arguments += sizeof(uint64_t);
+					if (negative == true)
+					{
+						writer.Append("-", 1ULL);
+					}
+
+					writer.AppendUnsigned(
+						magnitude
+					);
+					if (tag == _EncodedArguments::FloatingTag)
+					{
+						writer.Append(".", 1ULL);
+						unsigned long long divisor = 100000ULL;
+						while (divisor > 0ULL)
+						{
+							char digit = static_cast<char>('0' + (fraction / divisor) % 10ULL);
+							writer.Append(&digit, 1ULL);
+							divisor /= 10ULL;
+						}
+					}
+				}
+				else
+				{
+					arguments = argumentsEnd;
+				}
+			}
+
+			token = _NextTemplateToken(
+				text,
+				position
+			);
+		}
+
+		writer.Append("\n", 1ULL);
+	};
+
+	/**
+	* @brief Crash drain of the backtrace ring. Writes every record that has not been dumped yet.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _DrainBacktrace(
+		int fileDescriptor
+	) {
+		_BacktraceRing* backtrace = _ActiveBacktrace().load(std::memory_order_acquire);
+		if (backtrace == nullptr)
+		{
+			return;
+		}
+
+		// The ring is drained into every target, so it is only read here and never claimed
+		uint64_t end = backtrace->Next.load(std::memory_order_acquire);
+		uint64_t begin = backtrace->Dumped.load(std::memory_order_acquire);
+		if (end - begin > backtrace->Count)
+		{
+			begin = end - backtrace->Count;
+		}
+
+		_SignalSafeWriter writer = _SignalSafeWriter();
+		writer.FileDescriptor = fileDescriptor;
+		alignas(8) char record[_BacktraceSlot::Capacity];
+		while (begin < end)
+		{
+			size_t size = backtrace->Read(
+				begin,
+				record
+			);
+			if (size > 0ULL)
+			{
+				_WriteRecordSignalSafe(
+					writer,
+					record,
+					size
+				);
+			}
+
+			begin += 1ULL;
+		}
+
+		writer.Flush();
+	};
+#endif // __linux__
+
+	/**
+	* @brief Creates the backtrace ring with the given number of records, or disables it if the count is 0.
+	*
+	* A previous ring is intentionally never freed, since other threads might still be writing into it.
+	*
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _ConfigureBacktrace(
+		size_t count
+	) {
+		_BacktraceRing* current = _ActiveBacktrace().load(std::memory_order_acquire);
+		if (count == 0ULL)
+		{
+			_ActiveBacktrace().store(
+				nullptr,
+				std::memory_order_release
+			);
+			return;
+		}
+
+		if (current != nullptr
+			&& current->Count == count)
+		{
+			return;
+		}
+
+		_BacktraceRing* backtrace = new _BacktraceRing();
+		backtrace->Slots = std::make_unique<_BacktraceSlot[]>(count);
+		backtrace->Count = count;
+		_ActiveBacktrace().store(
+			backtrace,
+			std::memory_order_release
+		);
+	#ifdef __linux__
+		RegisterCrashDrain(
+			&_DrainBacktrace
+		);
+	#endif // __linux__
+	};
+
+	/**
+	* @brief Helper for filters. The filter spec of the configuration unless the environment overrides it. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline std::string_view _FilterSpec(
+		const LoggerConfiguration& configuration
+	) {
+		const char* filter = std::getenv(
+			"SIMPLELOG_FILTER"
+		);
+		return filter != nullptr ? std::string_view(filter) : std::string_view(configuration.Filter);
+	};
+
+	/**
+	* @brief Helper function for logging. Changes whenever the logger is configured, so files that are kept open are opened again. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline std::atomic<uint64_t>& _LogFileGeneration()
+	{
+		static std::atomic<uint64_t> generation = 0ULL;
+
+		return generation;
+	}
+
+	inline void _WatchConfigFile(const std::filesystem::path& path);
+	inline void _ServeControlSocket(const std::filesystem::path& path);
+	inline void _ConfigureMetricsExporter(const std::filesystem::path& path, std::chrono::milliseconds interval);
+	inline void _StartHousekeeping();
+
+	/**
+	* @brief Helper for the configuration. The directory logs are written to when none is configured, an empty path if it cannot be found. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline const std::filesystem::path& _UserDirectory()
+	{
+		static const std::filesystem::path userDirectory = []() -> std::filesystem::path
+		{
+			std::filesystem::path path = std::filesystem::path();
+
+		#ifdef _WIN32
+			PWSTR winPath = nullptr;
+			if (SUCCEEDED(SHGetKnownFolderPath(FOLDERID_Documents, 0, nullptr, &winPath)))
+			{
+				std::wstring wString = std::wstring(
+					winPath
+				);
+				CoTaskMemFree(
+					winPath
+				);
+				path = wString;
+			}
+		#elif __linux__
+			const char* homeDir = std::getenv(
+				"HOME"
+			);
+			if (homeDir == nullptr)
+			{
+				return path;
+			}
+
+			path = homeDir;
+			path = path / "Documents";
+		#endif // _WIN32 or __linux__
+
+			return path;
+		}();
+
+		return userDirectory;
+	}
+
+	/**
+	* @brief Configures the logger variables (where to store files, which severity level to log).
+	*
+	* The configuration, the filter and the level of messages without a category are published together as one snapshot, so a message that is written at the same time sees either all of the old or all of the new settings.
+	*
+	* @author Narumikazuchi
+	* @date 01.07.2025
+	*/
+	inline void ConfigureLogger(
+		const LoggerConfiguration& configuration
+	) {
+		// An invalid pattern or filter throws before anything is changed
+		std::vector<_FilterRule> rules = _CompileFilter(
+			_FilterSpec(configuration)
+		);
+		LoggerConfiguration applied = configuration;
+		if (applied.LogDirectory.empty() == true)
+		{
+			applied.LogDirectory = _UserDirectory();
+		}
+
+		_ConfigurePattern(
+			applied.Pattern
+		);
+		{
+			_Filter& filter = _CurrentFilter();
+			std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+				filter.Mutex
+			);
+			_PublishSettings(
+				applied,
+				_PublishFilterRules(
+					filter,
+					std::move(rules)
+				)
+			);
+		}
+		_LogFileGeneration().fetch_add(
+			1ULL,
+			std::memory_order_release
+		);
+		_CurrentCrashTarget().WriteToConsole.store(
+			applied.WriteToConsole,
+			std::memory_order_release
+		);
+		_ConfigureCrashHandler(
+			applied.FlushOnCrash
+		);
+		_ConfigureFlightRecorder(
+			applied.FlightRecorderFile,
+			applied.FlightRecorderSize
+		);
+		_ConfigureBacktrace(
+			applied.BacktraceSize
+		);
+		// Call sites pass every message on while the flight recorder or the backtrace keeps them
+		_InvalidateCallSites();
+		_WatchConfigFile(
+			applied.ConfigFile
+		);
+		_ServeControlSocket(
+			applied.ControlSocket
+		);
+		_ConfigureMetricsExporter(
+			applied.MetricsFile,
+			applied.MetricsInterval
+		);
+		if (applied.DeduplicateMessages == true)
+		{
+			_StartHousekeeping();
+		}
+
+		if (applied.LogDirectory.empty() == false
+			&& std::filesystem::exists(applied.LogDirectory) == false)
+		{
+			std::filesystem::create_directories(
+				applied.LogDirectory
+			);
+		}
+	};
+
+	/**
+	* @brief Helper function for logging. Turns encoded arguments back into the text `UnrollArgument` would have produced. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline size_t DecodeArguments(
+		const char* data,
+		size_t size,
+		std::string* strings,
+		std::string_view* names,
+		bool* numeric,
+		size_t count
+	) {
+		size_t offset = 0ULL;
+		size_t index = 0ULL;
+		std::string_view name = std::string_view();
+		while (index < count
+			   && offset < size)
+		{
+			char tag = data[offset];
+			offset += 1ULL;
+			if (tag == _EncodedArguments::NameTag
+				&& offset < size)
+			{
+				size_t length = std::min<size_t>(
+					static_cast<uint8_t>(data[offset]),
+					size - offset - 1ULL
+				);
+				name = std::string_view(
+					data + offset + 1ULL,
+					length
+				);
+				offset += 1ULL + length;
+				continue;
+			}
+
+			if (names != nullptr)
+			{
+				names[index] = name;
+			}
+
+			if (numeric != nullptr)
+			{
+				numeric[index] = tag != _EncodedArguments::StringTag;
+			}
+
+			name = std::string_view();
+			if (tag == _EncodedArguments::StringTag
+				&& offset + sizeof(uint32_t) <= size)
+			{
+				uint32_t length = 0U;
+				std::memcpy(
+					&length,
+					data + offset,
+					sizeof(uint32_t)
+				);
+				offset += sizeof(uint32_t);
+				length = static_cast<uint32_t>(std::min<size_t>(
+					static_cast<size_t>(length),
+					size - offset
+				));
+				strings[index].assign(
+					data + offset,
+					length
+				);
+				offset += length;
+			}
+			else if (tag == _EncodedArguments::SignedTag
+					 && offset + sizeof(long long) <= size)
+			{
+				long long value = 0LL;
+				std::memcpy(
+					&value,
+					data + offset,
+					sizeof(long long)
+				);
+				offset += sizeof(long long);
+				strings[index] = std::to_string(
+					value
+				);
+			}
+			else if (tag == _EncodedArguments::UnsignedTag
+					 && offset + sizeof(unsigned long long) <= size)
+			{
+				unsigned long long value = 0ULL;
+				std::memcpy(
+					&value,
+					data + offset,
+					sizeof(unsigned long long)
+				);
+				offset += sizeof(unsigned long long);
+				strings[index] = std::to_string(
+					value
+				);
+			}
+			else if (tag == _EncodedArguments::FloatingTag
+					 && offset + sizeof(double) <= size)
+			{
+				double value = 0.0;
+				std::memcpy(
+					&value,
+					data + offset,
+					sizeof(double)
+				);
+				offset += sizeof(double);
+				strings[index] = std::to_string(
+					value
+				);
+			}
+			else
+			{
+				break;
+			}
+
+			index += 1ULL;
+		}
+
+		return index;
+	};
+
+	/**
+	* @brief Gets the id of the calling thread as it is written to the log. The id is only formatted once per thread.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline const std::string& _CurrentThreadId()
+	{
+		thread_local const std::string id = []()
+		{
+			std::stringstream stream = std::stringstream();
+			stream << std::this_thread::get_id();
+			return stream.str();
+		}();
+
+		return id;
+	}
+
+	/**
+	* @brief A latency histogram with logarithmic buckets; bucket `i` counts the durations of `2^(i-1)` up to `2^i - 1` nanoseconds.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct LatencyHistogram final
+	{
+	public:
+		static constexpr size_t BucketCount = 64ULL;
+
+		std::array<uint64_t, BucketCount> Buckets = { };
+		uint64_t Count = 0ULL;
+		uint64_t Sum = 0ULL;	///< In nanoseconds.
+		uint64_t Max = 0ULL;	///< In nanoseconds.
+
+		/**
+		* @brief Estimates a percentile from the buckets.
+		* @param percentile The percentile between 0 and 100.
+		* @return The upper bound of the bucket the percentile falls into, in nanoseconds.
+		*/
+		inline uint64_t Percentile(
+			double percentile
+		) const {
+			if (this->Count == 0ULL)
+			{
+				return 0ULL;
+			}
+
+			uint64_t rank = static_cast<uint64_t>(std::ceil(static_cast<double>(this->Count) * std::clamp(percentile, 0.0, 100.0) / 100.0));
+			uint64_t seen = 0ULL;
+			size_t index = 0ULL;
+			while (index < BucketCount)
+			{
+				seen += this->Buckets[index];
+				if (seen >= std::max<uint64_t>(rank, 1ULL))
+				{
+					break;
+				}
+
+				index += 1ULL;
+			}
+
+			uint64_t upper = index >= 63ULL ? std::numeric_limits<uint64_t>::max() : (1ULL << index) - 1ULL;
+			return std::min<uint64_t>(upper, this->Max);
+		};
+	};
+
+	/**
+	* @brief A snapshot of what the logger has done since the process started. Every array is indexed by `LogSeverity`.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct LoggerStatistics final
+	{
+	public:
+		static constexpr size_t LevelCount = 7ULL;
+
+		std::array<uint64_t, LevelCount> Accepted = { };	///< Records that satisfied the level of their call site.
+		std::array<uint64_t, LevelCount> Filtered = { };	///< Records that were discarded because of their level or call site.
+		std::array<uint64_t, LevelCount> Dropped = { };		///< Accepted records that were not written for any other reason than being a duplicate (scopes that ended normally or were full, no output).
+		std::array<uint64_t, LevelCount> Deduplicated = { };	///< Accepted records that were not written because they repeated the previous one.
+		std::array<uint64_t, LevelCount> Written = { };		///< Records that were written to at least one output, including summaries and the backtrace.
+		uint64_t BytesWritten = 0ULL;						///< Over all outputs.
+		LatencyHistogram CallTime = LatencyHistogram();		///< Time spent inside `WriteLog` for accepted records.
+		LatencyHistogram WriteTime = LatencyHistogram();	///< Time from the start of writing a record until every output has it.
+		LatencyHistogram FlushTime = LatencyHistogram();	///< Time to open, write and flush a single file.
+	};
+
+	/**
+	* @brief Helper for statistics. A histogram that is only written by its own thread. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _HistogramCounters final
+	{
+	public:
+		std::array<std::atomic<uint64_t>, LatencyHistogram::BucketCount> Buckets = { };
+		std::atomic<uint64_t> Count = 0ULL;
+		std::atomic<uint64_t> Sum = 0ULL;
+		std::atomic<uint64_t> Max = 0ULL;
+	};
+
+	/**
+	* @brief Helper for statistics. The counters of a single thread; only the owning thread writes them, so they never share a cache line with another thread. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct alignas(64) _ThreadStatistics final
+	{
+	public:
+		std::array<std::atomic<uint64_t>, LoggerStatistics::LevelCount> Accepted = { };
+		std::array<std::atomic<uint64_t>, LoggerStatistics::LevelCount> Filtered = { };
+		std::array<std::atomic<uint64_t>, LoggerStatistics::LevelCount> Dropped = { };
+		std::array<std::atomic<uint64_t>, LoggerStatistics::LevelCount> Deduplicated = { };
+		std::array<std::atomic<uint64_t>, LoggerStatistics::LevelCount> Written = { };
+		std::atomic<uint64_t> BytesWritten = 0ULL;
+		_HistogramCounters CallTime = _HistogramCounters();
+		_HistogramCounters WriteTime = _HistogramCounters();
+		_HistogramCounters FlushTime = _HistogramCounters();
+	};
+
+	/**
+	* @brief Helper for statistics. Every thread that has logged something; threads that have ended are merged into a single snapshot. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _StatisticsRegistry final
+	{
+	public:
+		std::mutex Mutex = std::mutex();
+		std::vector<const _ThreadStatistics*> Threads = std::vector<const _ThreadStatistics*>();
+		LoggerStatistics Retired = LoggerStatistics();
+	};
+
+	/**
+	* @brief Helper for statistics. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline _StatisticsRegistry& _Statistics()
+	{
+		static _StatisticsRegistry registry = _StatisticsRegistry();
+
+		return registry;
+	}
+
+	/**
+	* @brief Helper for statistics. Adds the counters of a thread to a snapshot. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _MergeStatistics(
+		const _ThreadStatistics& counters,
+		LoggerStatistics& statistics
+	) {
+		size_t index = 0ULL;
+		while (index < LoggerStatistics::LevelCount)
+		{
+			statistics.Accepted[index] += counters.Accepted[index].load(std::memory_order_relaxed);
+			statistics.Filtered[index] += counters.Filtered[index].load(std::memory_order_relaxed);
+			statistics.Dropped[index] += counters.Dropped[index].load(std::memory_order_relaxed);
+			statistics.Deduplicated[index] += counters.Deduplicated[index].load(std::memory_order_relaxed);
+			statistics.Written[index] += counters.Written[index].load(std::memory_order_relaxed);
+			index += 1ULL;
+		}
+
+		statistics.BytesWritten += counters.BytesWritten.load(std::memory_order_relaxed);
+		auto merge = [](const _HistogramCounters& from, LatencyHistogram& into)
+		{
+			size_t bucket = 0ULL;
+			while (bucket < LatencyHistogram::BucketCount)
+			{
+				into.Buckets[bucket] += from.Buckets[bucket].load(std::memory_order_relaxed);
+				bucket += 1ULL;
+			}
+
+			into.Count += from.Count.load(std::memory_order_relaxed);
+			into.Sum += from.Sum.load(std::memory_order_relaxed);
+			into.Max = std::max<uint64_t>(
+				into.Max,
+				from.Max.load(std::memory_order_relaxed)
+			);
+		};
+		merge(counters.CallTime, statistics.CallTime);
+		merge(counters.WriteTime, statistics.WriteTime);
+		merge(counters.FlushTime, statistics.FlushTime);
+	};
+
+	/**
+	* @brief Helper for statistics. Registers the counters of a thread for as long as the thread is alive. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _ThreadStatisticsHandle final
+	{
+	public:
+		_ThreadStatisticsHandle()
+		{
+			_StatisticsRegistry& registry = _Statistics();
+			std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+				registry.Mutex
+			);
+			registry.Threads.push_back(
+				&this->Counters
+			);
+	#ifdef __linux__
+			if (_CrashHandlerInstalled().load(std::memory_order_acquire) == true)
+			{
+				_CurrentSignalStack().Install();
+			}
+	#endif // __linux__
+		};
+
+		~_ThreadStatisticsHandle()
+		{
+			_StatisticsRegistry& registry = _Statistics();
+			std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+				registry.Mutex
+			);
+			_MergeStatistics(
+				this->Counters,
+				registry.Retired
+			);
+			std::erase(
+				registry.Threads,
+				&this->Counters
+			);
+		};
+
+		_ThreadStatistics Counters = _ThreadStatistics();
+	};
+
+	/**
+	* @brief Helper for statistics. Gets the counters of the calling thread. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline _ThreadStatistics& _CurrentStatistics()
+	{
+		thread_local _ThreadStatisticsHandle handle = _ThreadStatisticsHandle();
+
+		return handle.Counters;
+	}
+
+	/**
+	* @brief Helper for statistics. Adds to a counter that only the calling thread writes, so no atomic read-modify-write is needed. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _Count(
+		std::atomic<uint64_t>& counter,
+		uint64_t value = 1ULL
+	) {
+		counter.store(
+			counter.load(std::memory_order_relaxed) + value,
+			std::memory_order_relaxed
+		);
+	};
+
+	/**
+	* @brief Helper for statistics. Records the time since `start` in a histogram of the calling thread. Standalone use not supported.
+	* @return The time since `start` in nanoseconds.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline uint64_t _RecordLatency(
+		_HistogramCounters& histogram,
+		std::chrono::steady_clock::time_point start
+	) {
+		uint64_t nanoseconds = static_cast<uint64_t>(std::max<int64_t>(
+			std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count(),
+			0LL
+		));
+		size_t bucket = std::min<size_t>(
+			static_cast<size_t>(std::bit_width(nanoseconds)),
+			LatencyHistogram::BucketCount - 1ULL
+		);
+		_Count(
+			histogram.Buckets[bucket]
+		);
+		_Count(
+			histogram.Count
+		);
+		_Count(
+			histogram.Sum,
+			nanoseconds
+		);
+		if (nanoseconds > histogram.Max.load(std::memory_order_relaxed))
+		{
+			histogram.Max.store(
+				nanoseconds,
+				std::memory_order_relaxed
+			);
+		}
+
+		return nanoseconds;
+	};
+
+	/**
+	* @brief Helper for statistics. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline size_t _LevelIndex(
+		const LogLevel level
+	) {
+		return static_cast<size_t>(static_cast<LogSeverity>(level));
+	};
+
+	/**
+	* @brief Gets a snapshot of the statistics of the logger, merged over every thread that has ever logged something.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline LoggerStatistics Statistics()
+	{
+		_StatisticsRegistry& registry = _Statistics();
+		std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+			registry.Mutex
+		);
+		LoggerStatistics statistics = registry.Retired;
+		for (const _ThreadStatistics* counters : registry.Threads)
+		{
+			_MergeStatistics(
+				*counters,
+				statistics
+			);
+		}
+
+		return statistics;
+	};
+
+	/**
+	* @brief Helper function for logging. Converts a point in time into the local calendar time. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline std::tm _LocalTime(
+		std::chrono::system_clock::time_point now
+	) {
+		time_t time = std::chrono::system_clock::to_time_t(
+			now
+		);
+		std::tm tm;
+	#ifdef _WIN32
+		if (localtime_s(&tm, &time) != 0)
+	#elif __linux__
+		if (localtime_r(&time, &tm) == nullptr)
+	#endif
+		{
+			tm = std::tm();
+		}
+
+		return tm;
+	};
+
+	/**
+	* @brief Helper function for logging. Which characters have to be escaped. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	enum class _EscapeMode
+	{
+		Text,	///< Control characters (including DEL), so a record always stays on a single line.
+		Json	///< Control characters, quotes and backslashes.
+	};
+
+	/**
+	* @brief Helper function for logging. Finds the next character that has to be escaped, 32 or 16 bytes at a time where the instruction set allows it. Standalone use not supported.
+	* @return The index of the character or the size of the data if there is none.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline size_t _FindEscape(
+		const char* data,
+		size_t size,
+		size_t index,
+		const _EscapeMode mode
+	) {
+	#ifdef __AVX2__
+		const __m256i control = _mm256_set1_epi8(0x1F);
+		const __m256i quote = _mm256_set1_epi8(mode == _EscapeMode::Json ? '"' : 0x7F);
+		const __m256i backslash = _mm256_set1_epi8(mode == _EscapeMode::Json ? '\\' : 0x7F);
+		while (index + 32ULL <= size)
+		{
+			__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + index));
+			// A byte is a control character if max(byte, 0x1F) is 0x1F (unsigned)
+			__m256i found = _mm256_or_si256(
+				_mm256_cmpeq_epi8(_mm256_max_epu8(block, control), control),
+				_mm256_or_si256(
+					_mm256_cmpeq_epi8(block, quote),
+					_mm256_cmpeq_epi8(block, backslash)
+				)
+			);
+			uint32_t bits = static_cast<uint32_t>(_mm256_movemask_epi8(found));
+			if (bits != 0U)
+			{
+				return index + static_cast<size_t>(std::countr_zero(bits));
+			}
+
+			index += 32ULL;
+		}
+	#endif // __AVX2__
+	#if defined(__SSE2__) || defined(_M_X64)
+		const __m128i control16 = _mm_set1_epi8(0x1F);
+		const __m128i quote16 = _mm_set1_epi8(mode == _EscapeMode::Json ? '"' : 0x7F);
+		const __m128i backslash16 = _mm_set1_epi8(mode == _EscapeMode::Json ? '\\' : 0x7F);
+		while (index + 16ULL <= size)
+		{
+			__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+			__m128i found = _mm_or_si128(
+				_mm_cmpeq_epi8(_mm_max_epu8(block, control16), control16),
+				_mm_or_si128(
+					_mm_cmpeq_epi8(block, quote16),
+					_mm_cmpeq_epi8(block, backslash16)
+				)
+			);
+			uint32_t bits = static_cast<uint32_t>(_mm_movemask_epi8(found));
+			if (bits != 0U)
+			{
+				return index + static_cast<size_t>(std::countr_zero(bits));
+			}
+
+			index += 16ULL;
+		}
+	#endif // __SSE2__ or _M_X64
+
+		// Scalar fallback and the tail
+		while (index < size)
+		{
+			unsigned char character = static_cast<unsigned char>(data[index]);
+			if (character < 0x20U)
+			{
+				return index;
+			}
+
+			if (mode == _EscapeMode::Json
+				&& (character == '"'
+					|| character == '\\'))
+			{
+				return index;
+			}
+
+			if (mode == _EscapeMode::Text
+				&& character == 0x7FU)
+			{
+				return index;
+			}
+
+			index += 1ULL;
+		}
+
+		return size;
+	};
+
+	/**
+	* @brief Helper function for logging. Appends the value and escapes every character that would break the output. Runs without such characters are copied in bulk. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _AppendEscaped(
+		std::string& output,
+		std::string_view value,
+		const _EscapeMode mode
+	) {
+		static constexpr char hex[] = "0123456789abcdef";
+		size_t start = 0ULL;
+		size_t index = _FindEscape(
+			value.data(),
+			value.size(),
+			0ULL,
+			mode
+		);
+		while (index < value.size())
+		{
+			output.append(
+				value.data() + start,
+				index - start
+			);
+
+			unsigned char character = static_cast<unsigned char>(value[index]);
+			switch (character)
+			{
+				case '"':
+				{
+					output += "\\\"";
+					break;
+				}
+				case '\\':
+				{
+					output += "\\\\";
+					break;
+				}
+				case '\n':
+				{
+					output += "\\n";
+					break;
+				}
+				case '\r':
+				{
+					output += "\\r";
+					break;
+				}
+				case '\t':
+				{
+					output += "\\t";
+					break;
+				}
+				default:
+				{
+					output += mode == _EscapeMode::Json ? "\\u00" : "\\x";
+					output += hex[character >> 4U];
+					output += hex[character & 0x0FU];
+					break;
+				}
+			}
+
+			start = index + 1ULL;
+			index = _FindEscape(
+				value.data(),
+				value.size(),
+				start,
+				mode
+			);
+		}
+
+		output.append(
+			value.data() + start,
+			value.size() - start
+		);
+	};
+
+	/**
+	* @brief Helper function for logging. Replaces the placeholders of the template with the given arguments and appends the result. Standalone use not supported.
+	* @param sanitize True to escape control characters inside the arguments.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _FormatTemplate(
+		std::string& message,
+		std::string_view text,
+		const std::string* arguments,
+		size_t count,
+		bool sanitize
+	) {
+		size_t argumentIndex = 0ULL;
+		size_t position = 0ULL;
+		_TemplateToken token = _NextTemplateToken(
+			text,
+			position
+		);
+		while (token.Type != _TemplateToken::Kind::End)
+		{
+			if (token.Type == _TemplateToken::Kind::Text)
+			{
+				message.append(
+					text.data() + token.Begin,
+					token.Length
+				);
+			}
+			else
+			{
+				if (argumentIndex >= count)
+				{
+					throw std::runtime_error(
+						"Not enough arguments passed to satisfy message template."
+					);
+				}
+
+				if (sanitize == true)
+				{
+					_AppendEscaped(
+						message,
+						arguments[argumentIndex],
+						_EscapeMode::Text
+					);
+				}
+				else
+				{
+					message += arguments[argumentIndex];
+				}
+
+				argumentIndex += 1ULL;
+			}
+
+			token = _NextTemplateToken(
+				text,
+				position
+			);
+		}
+	};
+
+	/**
+	* @brief Helper function for logging. Appends a number with at least the given number of digits. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _AppendDigits(
+		std::string& output,
+		int value,
+		size_t digits
+	) {
+		char buffer[16] = { };
+		size_t length = 0ULL;
+		unsigned int remaining = value < 0 ? 0U : static_cast<unsigned int>(value);
+		while (length < digits
+			   || remaining > 0U)
+		{
+			buffer[sizeof(buffer) - 1ULL - length] = static_cast<char>('0' + remaining % 10U);
+			remaining /= 10U;
+			length += 1ULL;
+		}
+
+		output.append(
+			buffer + sizeof(buffer) - length,
+			length
+		);
+	};
+
+	/**
+	* @brief Helper function for logging. Writes the record as a single line according to the layout. Standalone use not supported.
+	* @param levelBegin Receives where the level column starts (for coloring) or `std::string::npos`.
+	* @param levelEnd Receives where the level column ends, including its padding.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _ComposeLine(
+		const Layout& layout,
+		const LogRecord& record,
+		const std::tm& tm,
+		std::string& line,
+		size_t& levelBegin,
+		size_t& levelEnd
+	) {
+		levelBegin = std::string::npos;
+		levelEnd = std::string::npos;
+		size_t index = 0ULL;
+		while (index < layout.Count)
+		{
+			const LayoutStep& step = layout.Steps[index];
+			index += 1ULL;
+			size_t begin = line.size();
+			switch (step.Type)
+			{
+				case LayoutStep::Kind::Literal:
+				{
+					line.append(
+						layout.Literals.data() + step.Begin,
+						step.Length
+					);
+					continue;
+				}
+				case LayoutStep::Kind::Time:
+				{
+					_AppendDigits(line, tm.tm_hour, 2ULL);
+					line += ':';
+					_AppendDigits(line, tm.tm_min, 2ULL);
+					line += ':';
+					_AppendDigits(line, tm.tm_sec, 2ULL);
+					break;
+				}
+				case LayoutStep::Kind::Date:
+				{
+					_AppendDigits(line, tm.tm_year + 1900, 4ULL);
+					line += '-';
+					_AppendDigits(line, tm.tm_mon + 1, 2ULL);
+					line += '-';
+					_AppendDigits(line, tm.tm_mday, 2ULL);
+					break;
+				}
+				case LayoutStep::Kind::Milliseconds:
+				{
+					_AppendDigits(
+						line,
+						static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(record.Time.time_since_epoch()).count() % 1000LL),
+						3ULL
+					);
+					break;
+				}
+				case LayoutStep::Kind::Microseconds:
+				{
+					_AppendDigits(
+						line,
+						static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(record.Time.time_since_epoch()).count() % 1000000LL),
+						6ULL
+					);
+					break;
+				}
+				case LayoutStep::Kind::Level:
+				{
+					levelBegin = begin;
+					line += record.Level.ToString();
+					break;
+				}
+				case LayoutStep::Kind::File:
+				case LayoutStep::Kind::Location:
+				{
+					size_t separator = record.Module.find_last_of(
+						"/\\"
+					);
+					line += separator == std::string_view::npos ? record.Module : record.Module.substr(separator + 1ULL);
+					if (step.Type == LayoutStep::Kind::Location)
+					{
+						line += ':';
+						line += record.Line;
+					}
+
+					break;
+				}
+				case LayoutStep::Kind::Line:
+				{
+					line += record.Line;
+					break;
+				}
+				case LayoutStep::Kind::Function:
+				{
+					line += record.Function;
+					break;
+				}
+				case LayoutStep::Kind::Thread:
+				{
+					line += record.ThreadId;
+					break;
+				}
+				case LayoutStep::Kind::Category:
+				{
+					line += record.Category;
+					break;
+				}
+				case LayoutStep::Kind::Message:
+				{
+					try
+					{
+						_FormatTemplate(
+							line,
+							record.Template,
+							record.Arguments,
+							record.ArgumentCount,
+							true
+						);
+					}
+					catch (const std::runtime_error&)
+					{
+						// Only records restored from binary can be incomplete
+						line += " <missing arguments>";
+					}
+
+					break;
+				}
+			}
+
+			// Padding is a single fill
+			size_t written = line.size() - begin;
+			if (written < step.Width)
+			{
+				if (step.LeftAlign == true)
+				{
+					line.append(
+						step.Width - written,
+						' '
+					);
+				}
+				else
+				{
+					line.insert(
+						begin,
+						step.Width - written,
+						' '
+					);
+				}
+			}
+
+			if (step.Type == LayoutStep::Kind::Level)
+			{
+				levelEnd = line.size();
+			}
+		}
+	};
+
+	#ifdef SIMPLELOG_DEFINE_BACKEND
+	/**
+	* @brief Helper function for logging. Writes the location and the template of a binary record into the buffer. Standalone use not supported.
+	* @return The offset at which the encoded arguments start.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API size_t _EncodeRecordLocation(
+		_BinaryRecordHeader& header,
+		char* record,
+		size_t capacity,
+		const LogLevel level,
+		std::string_view module,
+		std::string_view line,
+		std::string_view function,
+		std::string_view messageTemplate
+	) {
+		const std::string& threadId = _CurrentThreadId();
+		header.Time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::system_clock::now().time_since_epoch()
+		).count();
+		header.Level = static_cast<uint8_t>(static_cast<LogSeverity>(level));
+
+		// Every field is clamped to the remaining space, so arguments are truncated before the location is
+		size_t offset = sizeof(_BinaryRecordHeader);
+		auto append = [&](std::string_view value, size_t limit) -> uint16_t
+		{
+			size_t length = std::min<size_t>(
+				std::min<size_t>(value.size(), limit),
+				capacity - offset
+			);
+			std::memcpy(
+				record + offset,
+				value.data(),
+				length
+			);
+			offset += length;
+			return static_cast<uint16_t>(length);
+		};
+		header.ModuleLength = append(module, 1024ULL);
+		header.LineLength = append(line, 16ULL);
+		header.FunctionLength = append(function, 512ULL);
+		header.TemplateLength = append(messageTemplate, 4096ULL);
+		header.ThreadLength = append(threadId, 64ULL);
+		return offset;
+	};
+
+	/**
+	* @brief Helper function for logging. Completes a binary record once its arguments are encoded. Standalone use not supported.
+	* @return The size of the record rounded up to a multiple of 8 bytes or zero if it does not fit.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API size_t _FinishRecord(
+		_BinaryRecordHeader& header,
+		char* record,
+		size_t capacity,
+		size_t offset,
+		const _EncodedArguments& encoded
+	) {
+		header.ArgumentCount = static_cast<uint8_t>(encoded.Count);
+		header.ArgumentsLength = static_cast<uint32_t>(encoded.Size);
+		offset += encoded.Size;
+
+		size_t size = (offset + 7ULL) & ~static_cast<size_t>(7ULL);
+		if (size > capacity)
+		{
+			return 0ULL;
+		}
+
+		header.Magic = _BinaryRecordHeader::ExpectedMagic;
+		header.Size = static_cast<uint32_t>(size);
+		std::memcpy(
+			record,
+			&header,
+			sizeof(_BinaryRecordHeader)
+		);
+		return size;
+	};
+
+	/**
+	* @brief Helper function for logging. Copies a record into the flight recorder and, if it is discarded because of the severity, into the backtrace ring. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API void _StoreRecord(
+		const _LogRoute& route,
+		const char* record,
+		size_t size
+	) {
+		if (route.Recorder != nullptr
+			&& size <= route.Recorder->Capacity / 2ULL)
+		{
+			route.Recorder->Write(
+				record,
+				size
+			);
+		}
+
+		if (route.Backtrace != nullptr)
+		{
+			route.Backtrace->Write(
+				record,
+				size
+			);
+		}
+	};
+	#endif // SIMPLELOG_DEFINE_BACKEND
+
+	/**
+	* @brief Helper function for logging. A record restored from its binary form, including the storage its views point into. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _DecodedRecord final
+	{
+	public:
+		LogRecord Record = LogRecord();
+		std::array<std::string, 256ULL> Arguments = { };
+		std::array<std::string_view, 256ULL> Names = { };
+		std::array<bool, 256ULL> Numeric = { };
+		const CallSite* Site = nullptr;		///< Only valid inside the process that wrote the record, so it is not part of `Record` (see `_RestoreRoute`).
+		size_t Category = 0ULL;
+	};
+
+	/**
+	* @brief Helper function for logging. Restores a record from its binary form. Standalone use not supported.
+	* @return False if the record is incomplete.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline bool _DecodeRecord(
+		const char* record,
+		size_t size,
+		_DecodedRecord& decoded
+	) {
+		_BinaryRecordHeader header = _BinaryRecordHeader();
+		if (size < sizeof(_BinaryRecordHeader))
+		{
+			return false;
+		}
+
+		std::memcpy(
+			&header,
+			record,
+			sizeof(_BinaryRecordHeader)
+		);
+		size_t payloadSize = static_cast<size_t>(header.ModuleLength) + header.LineLength + header.FunctionLength + header.TemplateLength + header.ThreadLength + header.ArgumentsLength;
+		if (header.Magic != _BinaryRecordHeader::ExpectedMagic
+			|| sizeof(_BinaryRecordHeader) + payloadSize > size)
+		{
+			return false;
+		}
+
+		LogRecord& result = decoded.Record;
+		const char* payload = record + sizeof(_BinaryRecordHeader);
+		result.Module = std::string_view(payload, header.ModuleLength);
+		payload += header.ModuleLength;
+		result.Line = std::string_view(payload, header.LineLength);
+		payload += header.LineLength;
+		result.Function = std::string_view(payload, header.FunctionLength);
+		payload += header.FunctionLength;
+		result.Template = std::string_view(payload, header.TemplateLength);
+		payload += header.TemplateLength;
+		result.ThreadId = std::string_view(payload, header.ThreadLength);
+		payload += header.ThreadLength;
+
+		size_t count = DecodeArguments(
+			payload,
+			header.ArgumentsLength,
+			decoded.Arguments.data(),
+			decoded.Names.data(),
+			decoded.Numeric.data(),
+			header.ArgumentCount
+		);
+		while (count < header.ArgumentCount)
+		{
+			decoded.Arguments[count] = "<truncated>";
+			decoded.Names[count] = std::string_view();
+			decoded.Numeric[count] = false;
+			count += 1ULL;
+		}
+
+		result.Level = LogLevel(static_cast<LogSeverity>(header.Level));
+		result.Time = std::chrono::system_clock::time_point(
+			std::chrono::duration_cast<std::chrono::system_clock::duration>(
+				std::chrono::nanoseconds(header.Time)
+			)
+		);
+		result.Arguments = decoded.Arguments.data();
+		result.Names = decoded.Names.data();
+		result.Numeric = decoded.Numeric.data();
+		result.ArgumentCount = count;
+		result.Site = nullptr;
+		result.Category = std::string_view();
+		result.Sinks = CategorySinks::All;
+		decoded.Site = header.Site;
+		decoded.Category = header.Category;
+		return true;
+	};
+
+	/**
+	* @brief Helper function for logging. Restores the call site, the category and the outputs of a record that was written by this process, so it is written like it would have been written directly. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _RestoreRoute(
+		_DecodedRecord& decoded
+	) {
+		_CategoryTable& table = _Categories();
+		size_t category = decoded.Category < table.Count.load(std::memory_order_acquire) ? decoded.Category : 0ULL;
+		const _Category& entry = table.Categories[category];
+		decoded.Record.Site = decoded.Site;
+		decoded.Record.Category = std::string_view(entry.Name.data(), entry.NameLength);
+		decoded.Record.Sinks = entry.EffectiveSinks.load(std::memory_order_relaxed);
+	};
+
+	/**
+	* @brief Helper function for logging. Gets the daily log file for the given day. Standalone use not supported.
+	* @param extension The extension of the file, including the dot.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline std::filesystem::path _LogFilePath(
+		const std::filesystem::path& directory,
+		std::string_view prefix,
+		std::string_view postfix,
+		const std::tm& tm,
+		std::string_view extension
+	) {
+		std::filesystem::path filePath = std::filesystem::path();
+		if (tm.tm_year == 0)
+		{
+			std::string filename = std::string(prefix);
+			filename += "General";
+			filename += postfix;
+			filename += extension;
+			filePath = directory / filename;
+		}
+		else
+		{
+			filePath = directory;
+			std::string filename = std::string();
+			filename += prefix;
+			filename += std::to_string(
+				tm.tm_year + 1900
+			);
+			filename += "_";
+			if (tm.tm_mon < 9)
+			{
+				filename += "0";
+			}
+			
+			filename += std::to_string(
+				tm.tm_mon + 1
+			);
+			filename += "_";
+			if (tm.tm_mday < 10)
+			{
+				filename += "0";
+			}
+			
+			filename += std::to_string(
+				tm.tm_mday
+			);
+			filename += postfix;
+			filename += extension;
+			filePath /= filename;
+		}
+
+		return filePath;
+	};
+
+	/**
+	* @brief Helper function for logging. Gets the daily log file of the configured logger for the given day. Standalone use not supported.
+	* @param extension The extension of the file, including the dot.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline std::filesystem::path _LogFilePath(
+		const std::tm& tm,
+		std::string_view extension
+	) {
+		const LoggerConfiguration& configuration = CurrentConfiguration();
+		return _LogFilePath(
+			configuration.LogDirectory,
+			configuration.FileNamePrefix,
+			configuration.FileNamePostfix,
+			tm,
+			extension
+		);
+	};
+
+#ifdef __linux__
+	/**
+	* @brief Helper function for logging. A log file a thread keeps open with `AllocationFree`. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _OpenLogFile final
+	{
+	public:
+		~_OpenLogFile()
+		{
+			if (this->Descriptor >= 0)
+			{
+				close(this->Descriptor);
+			}
+		};
+
+		int Descriptor = -1;
+		int Day = -1;
+		uint64_t Generation = 0ULL;
+	};
+
+	/**
+	* @brief Helper function for logging. The log files of the calling thread. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _OpenLogFiles final
+	{
+	public:
+		_OpenLogFile Text = _OpenLogFile();
+		_OpenLogFile Json = _OpenLogFile();
+	};
+
+	/**
+	* @brief Helper function for logging. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline _OpenLogFiles& _CurrentLogFiles()
+	{
+		thread_local _OpenLogFiles files = _OpenLogFiles();
+
+		return files;
+	}
+
+	/**
+	* @brief Helper function for logging. Appends a line to a log file that stays open until the day changes or the logger is configured again, so writing does not allocate. Standalone use not supported.
+	* @return True if the line was written.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline bool _AppendLogFile(
+		_OpenLogFile& file,
+		const std::tm& tm,
+		std::string_view extension,
+		std::string_view line
+	) {
+		const int day = tm.tm_year * 1000 + tm.tm_yday;
+		const uint64_t generation = _LogFileGeneration().load(
+			std::memory_order_acquire
+		);
+		if (file.Descriptor < 0
+			|| file.Day != day
+			|| file.Generation != generation)
+		{
+			if (file.Descriptor >= 0)
+			{
+				close(file.Descriptor);
+			}
+
+			std::filesystem::path filePath = _LogFilePath(
+				tm,
+				extension
+			);
+			file.Descriptor = open(
+				filePath.c_str(),
+				O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC,
+				0644
+			);
+			file.Day = day;
+			file.Generation = generation;
+			if (file.Descriptor >= 0
+				&& extension == ".log"
+				&& CurrentConfiguration().FlushOnCrash == true)
+			{
+				_PublishCrashFile(
+					filePath
+				);
+			}
+		}
+
+		if (file.Descriptor < 0)
+		{
+			return false;
+		}
+
+		// Lines of different threads never interleave, since every write appends atomically
+		_WriteAll(
+			file.Descriptor,
+			line.data(),
+			line.size()
+		);
+		return true;
+	};
+#endif // __linux__
+
+	/**
+	* @brief Helper function for logging. Appends a line to the daily log file with the given extension. Standalone use not supported.
+	* @return True if the line was written.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline bool _WriteLogFile(
+		const std::tm& tm,
+		std::string_view extension,
+		std::string_view line
+	) {
+	#ifdef __linux__
+		if (CurrentConfiguration().AllocationFree == true)
+		{
+			_OpenLogFiles& files = _CurrentLogFiles();
+			return _AppendLogFile(
+				extension == ".log" ? files.Text : files.Json,
+				tm,
+				extension,
+				line
+			);
+		}
+	#endif // __linux__
+
+		std::filesystem::path filePath = _LogFilePath(
+			tm,
+			extension
+		);
+		std::ofstream file(
+			filePath,
+			std::ios_base::out | std::ios_base::app
+		);
+		if (file.is_open() == false)
+		{
+			return false;
+		}
+
+		if (extension == ".log"
+			&& CurrentConfiguration().FlushOnCrash == true)
+		{
+			_PublishCrashFile(
+				filePath
+			);
+		}
+
+		file << line << std::flush;
+		file.close();
+		return true;
+	};
+
+	/**
+	* @brief Helper for JSON output. The static parts of a JSON line, between which only the values are written. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _JsonSkeleton final
+	{
+	public:
+		std::string Level = std::string();			///< Everything between the timestamp and the thread id.
+		std::vector<std::string> Keys = std::vector<std::string>();	///< The key (and opening quote) in front of every field value.
+		std::vector<bool> Numeric = std::vector<bool>();
+	};
+
+	/**
+	* @brief Helper for JSON output. Builds the static parts of the JSON lines of a record. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline _JsonSkeleton _BuildJsonSkeleton(
+		const LogRecord& record
+	) {
+		_JsonSkeleton skeleton = _JsonSkeleton();
+
+		// Module without its directory
+		std::string_view module = record.Module;
+		size_t index = module.find_last_of(
+			"/\\"
+		);
+		if (index != std::string_view::npos)
+		{
+			module = module.substr(
+				index + 1ULL
+			);
+		}
+
+		skeleton.Level = "\",\"level\":\"";
+		skeleton.Level += record.Level.ToString();
+		skeleton.Level += "\",\"file\":\"";
+		_AppendEscaped(
+			skeleton.Level,
+			module,
+			_EscapeMode::Json
+		);
+		// The line is a number, unless `WriteLog` was given something else; that is written as a string
+		bool digits = record.Line.size() <= 10ULL;
+		for (char character : record.Line)
+		{
+			digits = digits == true
+					 && character >= '0'
+					 && character <= '9';
+		}
+
+		if (digits == true)
+		{
+			skeleton.Level += "\",\"line\":";
+			skeleton.Level += record.Line.empty() == true ? std::string_view("0") : record.Line;
+			skeleton.Level += ",\"function\":\"";
+		}
+		else
+		{
+			skeleton.Level += "\",\"line\":\"";
+			_AppendEscaped(
+				skeleton.Level,
+				record.Line,
+				_EscapeMode::Json
+			);
+			skeleton.Level += "\",\"function\":\"";
+		}
+
+		_AppendEscaped(
+			skeleton.Level,
+			record.Function,
+			_EscapeMode::Json
+		);
+		if (record.Category.empty() == false)
+		{
+			skeleton.Level += "\",\"category\":\"";
+			_AppendEscaped(
+				skeleton.Level,
+				record.Category,
+				_EscapeMode::Json
+			);
+		}
+
+		skeleton.Level += "\",\"template\":\"";
+		_AppendEscaped(
+			skeleton.Level,
+			record.Template,
+			_EscapeMode::Json
+		);
+		skeleton.Level += "\",\"thread\":\"";
+
+		// Keys are the names given with Field, the names of the placeholders or the index of the argument
+		size_t position = 0ULL;
+		size_t argument = 0ULL;
+		_TemplateToken token = _NextTemplateToken(
+			record.Template,
+			position
+		);
+		while (argument < record.ArgumentCount)
+		{
+			while (token.Type == _TemplateToken::Kind::Text)
+			{
+				token = _NextTemplateToken(
+					record.Template,
+					position
+				);
+			}
+
+			std::string_view name = record.Names != nullptr ? record.Names[argument] : std::string_view();
+			if (name.empty() == true
+				&& token.Type == _TemplateToken::Kind::Placeholder)
+			{
+				name = record.Template.substr(
+					token.Begin,
+					token.Length
+				);
+			}
+
+			bool numeric = record.Numeric != nullptr
+						   && record.Numeric[argument] == true;
+			std::string key = argument == 0ULL ? std::string("\"") : std::string(",\"");
+			if (name.empty() == true)
+			{
+				key += std::to_string(
+					argument
+				);
+			}
+			else
+			{
+				_AppendEscaped(
+					key,
+					name,
+					_EscapeMode::Json
+				);
+			}
+
+			key += numeric == true ? "\":" : "\":\"";
+			skeleton.Keys.push_back(
+				key
+			);
+			skeleton.Numeric.push_back(
+				numeric
+			);
+			argument += 1ULL;
+			if (token.Type != _TemplateToken::Kind::End)
+			{
+				token = _NextTemplateToken(
+					record.Template,
+					position
+				);
+			}
+		}
+
+		return skeleton;
+	};
+
+	/**
+	* @brief Helper for JSON output. Writes the record as a single JSON object. Standalone use not supported.
+	*
+	* The static parts are built once per call site and only the values are written for every record.
+	*
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _ComposeJson(
+		const LogRecord& record,
+		std::string& output
+	) {
+		const _JsonSkeleton* skeleton = nullptr;
+		_JsonSkeleton temporary = _JsonSkeleton();
+		if (record.Site != nullptr)
+		{
+			skeleton = record.Site->Json.load(
+				std::memory_order_acquire
+			);
+			if (skeleton == nullptr)
+			{
+				// Losing the race only leaks a skeleton once per call site
+				const _JsonSkeleton* created = new _JsonSkeleton(_BuildJsonSkeleton(record));
+				const _JsonSkeleton* expected = nullptr;
+				if (record.Site->Json.compare_exchange_strong(expected, created, std::memory_order_acq_rel) == true)
+				{
+					skeleton = created;
+				}
+				else
+				{
+					delete created;
+					skeleton = expected;
+				}
+			}
+		}
+
+		// The sampling functions add arguments to the template of the call site
+		if (skeleton == nullptr
+			|| skeleton->Keys.size() != record.ArgumentCount)
+		{
+			temporary = _BuildJsonSkeleton(
+				record
+			);
+			skeleton = &temporary;
+		}
+
+		// Timestamp (UTC, ISO 8601)
+		time_t time = std::chrono::system_clock::to_time_t(
+			record.Time
+		);
+		std::tm tm = std::tm();
+	#ifdef _WIN32
+		gmtime_s(&tm, &time);
+	#elif __linux__
+		gmtime_r(&time, &tm);
+	#endif
+		long long milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(record.Time.time_since_epoch()).count() % 1000LL;
+		char timestamp[32] = { };
+		size_t length = std::strftime(
+			timestamp,
+			sizeof(timestamp),
+			"%Y-%m-%dT%H:%M:%S",
+			&tm
+		);
+		timestamp[length] = '.';
+		timestamp[length + 1ULL] = static_cast<char>('0' + milliseconds / 100LL);
+		timestamp[length + 2ULL] = static_cast<char>('0' + milliseconds / 10LL % 10LL);
+		timestamp[length + 3ULL] = static_cast<char>('0' + milliseconds % 10LL);
+		timestamp[length + 4ULL] = 'Z';
+
+		output += "{\"timestamp\":\"";
+		output.append(
+			timestamp,
+			length + 5ULL
+		);
+		output += skeleton->Level;
+		_AppendEscaped(
+			output,
+			record.ThreadId,
+			_EscapeMode::Json
+		);
+		output += "\",\"message\":\"";
+		thread_local std::string message = std::string();
+		message.clear();
+		_FormatTemplate(
+			message,
+			record.Template,
+			record.Arguments,
+			record.ArgumentCount,
+			false
+		);
+		_AppendEscaped(
+			output,
+			message,
+			_EscapeMode::Json
+		);
+		output += "\",\"fields\":{";
+
+		size_t index = 0ULL;
+		while (index < record.ArgumentCount)
+		{
+			output += skeleton->Keys[index];
+			if (skeleton->Numeric[index] == true)
+			{
+				// inf and nan are no valid JSON numbers
+				const std::string& value = record.Arguments[index];
+				if (value.find_first_of("ni") != std::string::npos)
+				{
+					output += "null";
+				}
+				else
+				{
+					output += value;
+				}
+			}
+			else
+			{
+				_AppendEscaped(
+					output,
+					record.Arguments[index],
+					_EscapeMode::Json
+				);
+				output += "\"";
+			}
+
+			index += 1ULL;
+		}
+
+		output += "}}\n";
+	};
+
+	/**
+	* @brief Helper function for logging. Writes a composed line to the console with the level column colored. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _WriteConsole(
+		std::string_view line,
+		const LogLevel level,
+		size_t levelBegin,
+		size_t levelEnd
+	) {
+		std::string_view color = std::string_view();
+		switch (level)
+		{
+			case LogLevels::Debug:
+			{
+				color = "\033[36m";
+				break;
+			}
+			case LogLevels::Information:
+			{
+				color = "\033[32m";
+				break;
+			}
+			case LogLevels::Warning:
+			{
+				color = "\033[33m";
+				break;
+			}
+			case LogLevels::Error:
+			{
+				color = "\033[31m";
+				break;
+			}
+			case LogLevels::Critical:
+			{
+				color = "\033[41m";
+				break;
+			}
+			default:
+			{
+				break;
+			}
+		}
+
+		if (color.empty() == true
+			|| levelBegin == std::string::npos)
+		{
+			std::cout << line << std::flush;
+		}
+		else
+		{
+			std::cout << line.substr(0ULL, levelBegin) << color << line.substr(levelBegin, levelEnd - levelBegin) << "\033[m" << line.substr(levelEnd) << std::flush;
+		}
+	};
+
+	/**
+	* @brief Helper function for logging. Writes a record to all configured outputs. Standalone use not supported.
+	* @return The number of bytes written over all outputs.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline uint64_t _Emit(
+		const LogRecord& record
+	) {
+		// The category of the record can turn off outputs
+		const LoggerConfiguration& configuration = CurrentConfiguration();
+		const bool writeConsole = configuration.WriteToConsole == true
+								  && (record.Sinks & CategorySinks::Console) != 0U;
+		const bool writeFile = configuration.WriteToFile == true
+							   && (record.Sinks & CategorySinks::File) != 0U;
+		const bool writeJson = configuration.WriteToJsonFile == true
+							   && (record.Sinks & CategorySinks::JsonFile) != 0U;
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		_ThreadStatistics& statistics = _CurrentStatistics();
+		uint64_t bytes = 0ULL;
+		std::tm tm = _LocalTime(
+			record.Time
+		);
+		if (writeConsole == true
+			|| writeFile == true)
+		{
+			// Reused by every record of the thread, so composing does not allocate after warm-up
+			thread_local std::string line = std::string();
+			line.clear();
+			size_t levelBegin = std::string::npos;
+			size_t levelEnd = std::string::npos;
+			_ComposeLine(
+				_CurrentLayout(),
+				record,
+				tm,
+				line,
+				levelBegin,
+				levelEnd
+			);
+			line += '\n';
+
+			// Write to console, the level column is colored
+			if (writeConsole == true)
+			{
+				_WriteConsole(
+					line,
+					record.Level,
+					levelBegin,
+					levelEnd
+				);
+				bytes += line.size();
+			}
+
+			// Log to file, if log directory has been set
+			if (writeFile == true
+				&& configuration.LogDirectory.empty() == false)
+			{
+				const std::chrono::steady_clock::time_point flushStart = std::chrono::steady_clock::now();
+				if (_WriteLogFile(tm, ".log", line) == true)
+				{
+					bytes += line.size();
+					_RecordLatency(
+						statistics.FlushTime,
+						flushStart
+					);
+				}
+			}
+		}
+
+		// Log to JSON Lines file
+		if (writeJson == true
+			&& configuration.LogDirectory.empty() == false)
+		{
+			thread_local std::string line = std::string();
+			line.clear();
+			_ComposeJson(
+				record,
+				line
+			);
+			const std::chrono::steady_clock::time_point flushStart = std::chrono::steady_clock::now();
+			if (_WriteLogFile(tm, ".jsonl", line) == true)
+			{
+				bytes += line.size();
+				_RecordLatency(
+					statistics.FlushTime,
+					flushStart
+				);
+			}
+		}
+
+		if (bytes > 0ULL)
+		{
+			_Count(
+				statistics.Written[_LevelIndex(record.Level)]
+			);
+			_Count(
+				statistics.BytesWritten,
+				bytes
+			);
+			_RecordLatency(
+				statistics.WriteTime,
+				start
+			);
+		}
+
+		return bytes;
+	};
+
+	/**
+	* @brief Helper function for logging. Whether any output is configured at all. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline bool _HasOutput()
+	{
+		const LoggerConfiguration& configuration = CurrentConfiguration();
+		return configuration.WriteToConsole == true
+			   || configuration.WriteToFile == true
+			   || configuration.WriteToJsonFile == true;
+	};
+
+
+	/**
+	* @brief Helper function for logging. Writes all records of the backtrace ring that have not been written yet. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _DumpBacktrace(
+		_BacktraceRing& backtrace
+	) {
+		uint64_t begin = 0ULL;
+		uint64_t end = 0ULL;
+		backtrace.Claim(
+			begin,
+			end
+		);
+
+		alignas(8) char record[_BacktraceSlot::Capacity];
+		_DecodedRecord decoded = _DecodedRecord();
+		while (begin < end)
+		{
+			size_t size = backtrace.Read(
+				begin,
+				record
+			);
+			begin += 1ULL;
+
+			if (size == 0ULL
+				|| _DecodeRecord(record, size, decoded) == false)
+			{
+				continue;
+			}
+
+			// The record was kept because of the severity only, so a call site that is switched off since is still left out
+			if (decoded.Site != nullptr
+				&& decoded.Site->State.load(std::memory_order_relaxed) == CallSiteState::Disabled)
+			{
+				continue;
+			}
+
+			_RestoreRoute(
+				decoded
+			);
+			_Emit(
+				decoded.Record
+			);
+		}
+	};
+
+	/**
+	* @brief Helper for duplicate suppression. Remembers the hash of the last message a thread wrote and how often it was repeated since. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _Deduplicator final
+	{
+	public:
+		std::mutex Mutex = std::mutex();	///< Only contended when the background worker or `FlushLogger` writes the summary.
+		size_t Hash = 0ULL;
+		LogLevel Level = LogLevels::Disabled;
+		const CallSite* Site = nullptr;
+		uint8_t Sinks = CategorySinks::All;
+		const std::string* ThreadId = nullptr;
+		uint64_t Repeats = 0ULL;
+		std::chrono::steady_clock::time_point RunStarted = std::chrono::steady_clock::time_point();
+	};
+
+	/**
+	* @brief Helper for duplicate suppression. The deduplicators of all threads that are alive, so their summaries can be written without them. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _DeduplicatorRegistry final
+	{
+	public:
+		std::mutex Mutex = std::mutex();
+		std::vector<_Deduplicator*> Threads = std::vector<_Deduplicator*>();
+	};
+
+	/**
+	* @brief Helper for duplicate suppression. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline _DeduplicatorRegistry& _Deduplicators()
+	{
+		static _DeduplicatorRegistry registry = _DeduplicatorRegistry();
+
+		return registry;
+	}
+
+	/**
+	* @brief Helper for duplicate suppression. Writes the "repeated" summary of the current run and resets the counter. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _WriteRepeatSummary(
+		_Deduplicator& deduplicator
+	) {
+		if (deduplicator.Repeats == 0ULL)
+		{
+			return;
+		}
+
+		std::string repeats = std::to_string(
+			deduplicator.Repeats
+		);
+		std::string_view name = std::string_view("repeats");
+		bool numeric = true;
+		deduplicator.Repeats = 0ULL;
+
+		// Written like the repeated message: from its call site, by its thread and to the outputs of its category
+		const CallSite& site = *deduplicator.Site;
+		const _Category& entry = _Categories().Categories[site.Category];
+		LogRecord record = LogRecord();
+		record.Time = std::chrono::system_clock::now();
+		record.Level = deduplicator.Level;
+		record.Module = site.Module;
+		record.Line = site.Line;
+		record.Function = site.Function;
+		record.ThreadId = *deduplicator.ThreadId;
+		record.Template = "Last message repeated {repeats} times";
+		record.Category = std::string_view(entry.Name.data(), entry.NameLength);
+		record.Sinks = deduplicator.Sinks;
+		record.Arguments = &repeats;
+		record.Names = &name;
+		record.Numeric = &numeric;
+		record.ArgumentCount = 1ULL;
+		_Emit(
+			record
+		);
+	};
+
+	/**
+	* @brief Helper for duplicate suppression. Registers the deduplicator of a thread for as long as the thread is alive and writes its last summary when the thread exits. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _DeduplicatorHandle final
+	{
+	public:
+		_DeduplicatorHandle()
+		{
+			// The id is created first, so it outlives the handle
+			this->State.ThreadId = &_CurrentThreadId();
+			_DeduplicatorRegistry& registry = _Deduplicators();
+			std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+				registry.Mutex
+			);
+			registry.Threads.push_back(
+				&this->State
+			);
+		};
+
+		~_DeduplicatorHandle()
+		{
+			_DeduplicatorRegistry& registry = _Deduplicators();
+			std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+				registry.Mutex
+			);
+			std::erase(
+				registry.Threads,
+				&this->State
+			);
+			std::lock_guard<std::mutex> stateLock = std::lock_guard<std::mutex>(
+				this->State.Mutex
+			);
+			_WriteRepeatSummary(
+				this->State
+			);
+		};
+
+		_Deduplicator State = _Deduplicator();
+	};
+
+	/**
+	* @brief Helper for duplicate suppression. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline _Deduplicator& _CurrentDeduplicator()
+	{
+		thread_local _DeduplicatorHandle handle = _DeduplicatorHandle();
+
+		return handle.State;
+	}
+
+	/**
+	* @brief Helper for duplicate suppression. Checks whether the message is identical to the one the calling thread wrote before. Standalone use not supported.
+	* @param hash The hash of the formatted message.
+	* @param sinks The outputs the message is written to, which the summary is written to as well.
+	* @return True if the message is a repetition and must not be written.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline bool _Deduplicate(
+		size_t hash,
+		const CallSite& site,
+		const LogLevel level,
+		uint8_t sinks
+	) {
+		_Deduplicator& deduplicator = _CurrentDeduplicator();
+		std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+			deduplicator.Mutex
+		);
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		if (deduplicator.Hash == hash
+			&& deduplicator.Site == &site
+			&& deduplicator.Level == level)
+		{
+			deduplicator.Repeats += 1ULL;
+			if (now - deduplicator.RunStarted >= CurrentConfiguration().DeduplicateInterval)
+			{
+				_WriteRepeatSummary(
+					deduplicator
+				);
+				deduplicator.RunStarted = now;
+			}
+
+			return true;
+		}
+
+		// The run has ended
+		_WriteRepeatSummary(
+			deduplicator
+		);
+		deduplicator.Hash = hash;
+		deduplicator.Site = &site;
+		deduplicator.Level = level;
+		deduplicator.Sinks = sinks;
+		deduplicator.RunStarted = now;
+		return false;
+	};
+
+	/**
+	* @brief Helper for duplicate suppression. Writes the summaries of the runs of every thread, either of the ones that have lasted longer than `DeduplicateInterval`, even if no further repetition comes, or of all of them. Standalone use not supported.
+	* @param everything True to write every summary and end the runs.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _ExpireDeduplicators(
+		bool everything
+	) {
+		_DeduplicatorRegistry& registry = _Deduplicators();
+		std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+			registry.Mutex
+		);
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		for (_Deduplicator* deduplicator : registry.Threads)
+		{
+			std::lock_guard<std::mutex> stateLock = std::lock_guard<std::mutex>(
+				deduplicator->Mutex
+			);
+			if (everything == true)
+			{
+				_WriteRepeatSummary(
+					*deduplicator
+				);
+				deduplicator->Hash = 0ULL;
+				deduplicator->Site = nullptr;
+				continue;
+			}
+
+			if (deduplicator->Repeats > 0ULL
+				&& now - deduplicator->RunStarted >= CurrentConfiguration().DeduplicateInterval)
+			{
+				_WriteRepeatSummary(
+					*deduplicator
+				);
+				deduplicator->RunStarted = now;
+			}
+		}
+	};
+
+	/**
+	* @brief Helper for scoped logging. The per-thread state of all active scopes. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _ScopeState final
+	{
+	public:
+		static constexpr size_t MaximumRecordSize = 8192ULL;
+
+		std::vector<char> Arena = std::vector<char>();
+		size_t Used = 0ULL;
+		size_t Limit = 0ULL;
+		size_t Dropped = 0ULL;
+		LogLevel Verbosity = LogLevels::Trace;
+		bool Failed = false;
+	};
+
+	/**
+	* @brief Helper for scoped logging. The arena is kept for the lifetime of the thread, so after warm-up buffering does not allocate. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline _ScopeState& _CurrentScopeState()
+	{
+		thread_local _ScopeState state = _ScopeState();
+
+		return state;
+	}
+
+	/**
+	* @brief Helper for scoped logging. Writes the buffered records and empties the arena. Standalone use not supported.
+	* @param everything True to write all records; false to only write the records that satisfy the configured severity.
+	* @return The number of records that were not written.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline size_t _FlushScope(
+		_ScopeState& state,
+		bool everything
+	) {
+		size_t skipped = 0ULL;
+		size_t offset = 0ULL;
+		_DecodedRecord decoded = _DecodedRecord();
+		while (offset < state.Used)
+		{
+			const char* record = state.Arena.data() + offset;
+			_BinaryRecordHeader header = _BinaryRecordHeader();
+			std::memcpy(
+				&header,
+				record,
+				sizeof(_BinaryRecordHeader)
+			);
+			offset += header.Size;
+
+			if (_DecodeRecord(record, header.Size, decoded) == false)
+			{
+				continue;
+			}
+
+			// Decided like the message would have been without the scope: by its call site, category and the filter
+			if (everything == false
+				&& decoded.Record.Level > _SiteSeverity(decoded.Site, decoded.Record.Module, decoded.Record.Function))
+			{
+				_Count(
+					_CurrentStatistics().Dropped[header.Level]
+				);
+				skipped += 1ULL;
+				continue;
+			}
+
+			_RestoreRoute(
+				decoded
+			);
+			if (_Emit(decoded.Record) == 0ULL)
+			{
+				_Count(
+					_CurrentStatistics().Dropped[header.Level]
+				);
+			}
+		}
+
+		state.Used = 0ULL;
+		return skipped;
+	};
+
+	#ifdef SIMPLELOG_DEFINE_BACKEND
+	/**
+	* @brief Helper for scoped logging. Makes room for a record in the arena of the calling thread. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API char* _ReserveScoped(
+		_ScopeState& state,
+		const LogLevel level,
+		size_t& capacity
+	) {
+		if (state.Used + _ScopeState::MaximumRecordSize > state.Arena.size())
+		{
+			if (state.Arena.size() >= state.Limit)
+			{
+				_Count(
+					_CurrentStatistics().Dropped[_LevelIndex(level)]
+				);
+				state.Dropped += 1ULL;
+				return nullptr;
+			}
+
+			state.Arena.resize(
+				std::max<size_t>(
+					state.Arena.size() * 2ULL,
+					_ScopeState::MaximumRecordSize * 8ULL
+				)
+			);
+		}
+
+		capacity = _ScopeState::MaximumRecordSize;
+		return state.Arena.data() + state.Used;
+	};
+
+	/**
+	* @brief Helper for scoped logging. An Error or Critical fails the scope and writes everything buffered so far. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API void _CommitScoped(
+		_ScopeState& state,
+		const LogLevel level,
+		size_t size
+	) {
+		state.Used += size;
+		if (level <= LogLevels::Error)
+		{
+			state.Failed = true;
+			_FlushScope(
+				state,
+				true
+			);
+		}
+	};
+	#endif // SIMPLELOG_DEFINE_BACKEND
+
+	/**
+	* @brief Buffers every message the current thread logs while the scope is alive.
+	*
+	* If the scope ends normally, only the buffered messages that satisfy the configured severity are written and the rest is dropped. If an Error or Critical is logged inside the scope, the scope is failed by calling `Fail()` or the scope is left by an exception, all buffered messages are written in full and the following messages are written directly.
+	* Nested scopes share the state of the outermost scope, which decides what is written.
+	*
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct Scope final
+	{
+	public:
+		/**
+		* @brief Starts buffering the messages of the current thread.
+		* @param verbosity The most detailed level that will be buffered. Messages above it are discarded as usual.
+		* @param summarize If true a single Information message with the number of dropped messages is written when the scope ends normally.
+		* @param limit The maximum number of bytes buffered for the thread. Further messages are dropped and counted.
+		* @author Narumikazuchi
+		* @date 16.10.2026
+		*/
+		Scope(
+			LogLevel verbosity = LogLevels::Trace,
+			bool summarize = false,
+			size_t limit = 1024ULL * 1024ULL,
+			std::source_location location = std::source_location::current()
+		) : m_Location(location),
+			m_Exceptions(std::uncaught_exceptions()),
+			m_Summarize(summarize)
+		{
+			_ScopeState& state = _CurrentScopeState();
+			size_t& depth = _ScopeDepth();
+			if (depth == 0ULL)
+			{
+				state.Used = 0ULL;
+				state.Dropped = 0ULL;
+				state.Failed = false;
+				state.Verbosity = verbosity;
+				state.Limit = limit;
+			}
+
+			depth += 1ULL;
+		};
+
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+
+		~Scope()
+		{
+			_ScopeState& state = _CurrentScopeState();
+			if (std::uncaught_exceptions() > m_Exceptions)
+			{
+				this->Fail();
+			}
+
+			size_t& depth = _ScopeDepth();
+			depth -= 1ULL;
+			if (depth > 0ULL)
+			{
+				return;
+			}
+
+			size_t dropped = state.Dropped + _FlushScope(
+				state,
+				state.Failed
+			);
+			if (m_Summarize == false
+				|| state.Failed == true
+				|| dropped == 0ULL
+				|| LogLevels::Information > CurrentConfiguration().Severity
+				|| _HasOutput() == false)
+			{
+				return;
+			}
+
+			std::string line = std::to_string(
+				m_Location.line()
+			);
+			std::string count = std::to_string(
+				dropped
+			);
+			std::string_view name = std::string_view("dropped");
+			bool numeric = true;
+
+			LogRecord record = LogRecord();
+			record.Time = std::chrono::system_clock::now();
+			record.Level = LogLevels::Information;
+			record.Module = m_Location.file_name();
+			record.Line = line;
+			record.Function = m_Location.function_name();
+			record.ThreadId = _CurrentThreadId();
+			record.Template = "Scope ended successfully, {dropped} buffered messages were dropped";
+			record.Arguments = &count;
+			record.Names = &name;
+			record.Numeric = &numeric;
+			record.ArgumentCount = 1ULL;
+			_Emit(
+				record
+			);
+		};
+
+		/**
+		* @brief Marks the scope as failed. Everything buffered so far is written and the following messages are written directly.
+		* @author Narumikazuchi
+		* @date 16.10.2026
+		*/
+		inline void Fail()
+		{
+			_ScopeState& state = _CurrentScopeState();
+			if (state.Failed == true)
+			{
+				return;
+			}
+
+			state.Failed = true;
+			_FlushScope(
+				state,
+				true
+			);
+		};
+
+	private:
+		std::source_location m_Location;
+		int m_Exceptions;
+		bool m_Summarize;
+	};
+
+	/**
+	* @brief Prints the contents of a flight recorder file in the normal text layout, oldest record first.
+	* @param path The flight recorder file (`LoggerConfiguration::FlightRecorderFile`).
+	* @param output The stream to print the records to.
+	* @param writeThreadId Whether the thread column should be printed.
+	* @return True if the file could be read; otherwise false.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline bool DecodeFlightRecorder(
+		const std::filesystem::path& path,
+		std::ostream& output,
+		bool writeThreadId = true
+	) {
+		std::ifstream file(
+			path,
+			std::ios_base::in | std::ios_base::binary
+		);
+		if (file.is_open() == false)
+		{
+			return false;
+		}
+
+		_FlightRecorderHeader header = _FlightRecorderHeader();
+		file.read(
+			reinterpret_cast<char*>(&header),
+			sizeof(_FlightRecorderHeader)
+		);
+		if (file.good() == false
+			|| header.Magic != _FlightRecorderHeader::ExpectedMagic
+			|| header.Capacity == 0ULL
+			|| header.Capacity % 8ULL != 0ULL)
+		{
+			return false;
+		}
+
+		std::vector<char> data = std::vector<char>(header.Capacity);
+		file.read(
+			data.data(),
+			static_cast<std::streamsize>(header.Capacity)
+		);
+		if (file.good() == false)
+		{
+			return false;
+		}
+
+		const uint64_t capacity = header.Capacity;
+		const uint64_t head = header.Head;
+		auto copyFrom = [&](uint64_t position, char* target, size_t size)
+		{
+			size_t offset = static_cast<size_t>(position % capacity);
+			size_t first = std::min<size_t>(
+				size,
+				static_cast<size_t>(capacity) - offset
+			);
+			std::memcpy(target, data.data() + offset, first);
+			std::memcpy(target + first, data.data(), size - first);
+		};
+		auto sizeAt = [&](uint64_t position) -> uint64_t
+		{
+			uint32_t values[2] = { };
+			copyFrom(position, reinterpret_cast<char*>(values), sizeof(values));
+			if ((values[0] != _BinaryRecordHeader::ExpectedMagic
+				 && values[0] != 0U)
+				|| values[1] < sizeof(_BinaryRecordHeader)
+				|| values[1] % 8U != 0U
+				|| values[1] > capacity)
+			{
+				return 0ULL;
+			}
+
+			return values[1];
+		};
+
+		// The oldest record might have been partially overwritten, so look for the first position whose chain of records ends exactly at the head
+		uint64_t start = head > capacity ? head - capacity : 0ULL;
+		start = (start + 7ULL) & ~static_cast<uint64_t>(7ULL);
+		while (start < head)
+		{
+			uint64_t position = start;
+			while (position < head)
+			{
+				uint64_t size = sizeAt(position);
+				if (size == 0ULL)
+				{
+					break;
+				}
+
+				position += size;
+			}
+
+			if (position == head)
+			{
+				break;
+			}
+
+			start += 8ULL;
+		}
+
+		std::vector<char> record = std::vector<char>();
+		_DecodedRecord decoded = _DecodedRecord();
+		const Layout& layout = writeThreadId == true ? Layouts::DefaultWithThread : Layouts::Default;
+		std::string line = std::string();
+		size_t levelBegin = std::string::npos;
+		size_t levelEnd = std::string::npos;
+		uint64_t position = start;
+		while (position < head)
+		{
+			uint64_t size = sizeAt(position);
+			record.resize(size);
+			copyFrom(position, record.data(), size);
+			position += size;
+
+			// Records torn by a crash while they were written are skipped
+			if (_DecodeRecord(record.data(), record.size(), decoded) == true)
+			{
+				line.clear();
+				_ComposeLine(
+					layout,
+					decoded.Record,
+					_LocalTime(decoded.Record.Time),
+					line,
+					levelBegin,
+					levelEnd
+				);
+				output << line << "\n";
+			}
+		}
+
+		output << std::flush;
+		return true;
+	};
+
+	/**
+	* @brief Helper function for logging. Counts a message of a call site that passed the level check. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _CountHit(
+		const CallSite* site
+	) {
+		if (site != nullptr)
+		{
+			site->Hits.fetch_add(
+				1ULL,
+				std::memory_order_relaxed
+			);
+		}
+	};
+
+	#ifdef SIMPLELOG_DEFINE_BACKEND
+	/**
+	* @brief Helper function for logging. Decides what a logging call has to do and counts the calls that do nothing. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API _LogRoute _RouteLog(
+		const CallSite* site,
+		const LogLevel level,
+		std::string_view module,
+		std::string_view function
+	) {
+		_LogRoute route = _LogRoute();
+
+		// A call site can be switched on or off at runtime
+		if (site != nullptr
+			&& site->State.load(std::memory_order_relaxed) == CallSiteState::Disabled)
+		{
+			_Count(
+				_CurrentStatistics().Filtered[_LevelIndex(level)]
+			);
+			return route;
+		}
+
+		// The flight recorder keeps every record, the backtrace only the ones that are discarded because of the severity
+		route.Category = site != nullptr ? site->Category : 0ULL;
+		const LogLevel severity = _SiteSeverity(
+			site,
+			module,
+			function
+		);
+		_ScopeState& scope = _CurrentScopeState();
+		const size_t depth = _ScopeDepth();
+		bool scoped = depth > 0ULL
+					  && scope.Failed == false
+					  && level <= scope.Verbosity;
+		route.Recorder = _ActiveFlightRecorder().load(std::memory_order_acquire);
+		route.Backtrace = scoped == false && level > severity ? _ActiveBacktrace().load(std::memory_order_acquire) : nullptr;
+		route.CaptureSize = route.Recorder != nullptr ? _LogRoute::MaximumCaptureSize : _BacktraceSlot::Capacity;
+
+		// Messages inside a scope are only written once the scope has ended or failed
+		if (scoped == true)
+		{
+			_Count(
+				_CurrentStatistics().Accepted[_LevelIndex(level)]
+			);
+			_CountHit(
+				site
+			);
+			route.Scope = &scope;
+			return route;
+		}
+
+		// Check if log level is satisfied (a failed scope writes everything up to its verbosity)
+		_ThreadStatistics& statistics = _CurrentStatistics();
+		if (level > severity
+			&& (depth == 0ULL
+				|| level > scope.Verbosity))
+		{
+			_Count(
+				statistics.Filtered[_LevelIndex(level)]
+			);
+			return route;
+		}
+
+		_CountHit(
+			site
+		);
+		route.Start = std::chrono::steady_clock::now().time_since_epoch().count();
+		_Count(
+			statistics.Accepted[_LevelIndex(level)]
+		);
+		if (_HasOutput() == false)
+		{
+			_Count(
+				statistics.Dropped[_LevelIndex(level)]
+			);
+			return route;
+		}
+
+		route.Write = true;
+		return route;
+	};
+
+	/**
+	* @brief Helper function for logging. Writes a message whose arguments are already formatted to all outputs. Every logging call shares this function, so only capturing the arguments depends on the template. Standalone use not supported.
+	* @param site The call site the message is written from, if any. It caches the static parts of the structured output.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API void _WriteFormatted(
+		const _LogRoute& route,
+		const CallSite* site,
+		const LogLevel level,
+		std::string_view module,
+		std::string_view line,
+		std::string_view function,
+		std::string_view messageTemplate,
+		const std::string* arguments,
+		const std::string_view* names,
+		const bool* numeric,
+		size_t argumentCount
+	) {
+		// Identical messages of the same call site are only counted
+		_ThreadStatistics& statistics = _CurrentStatistics();
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(route.Start));
+		const _Category& entry = _Categories().Categories[route.Category];
+		const uint8_t sinks = entry.EffectiveSinks.load(std::memory_order_relaxed);
+		if (site != nullptr
+			&& CurrentConfiguration().DeduplicateMessages == true)
+		{
+			size_t hash = std::hash<const void*>()(messageTemplate.data());
+			size_t index = 0ULL;
+			while (index < argumentCount)
+			{
+				hash ^= std::hash<std::string_view>()(arguments[index]) + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+				index += 1ULL;
+			}
+
+			if (_Deduplicate(hash, *site, level, sinks) == true)
+			{
+				_Count(
+					statistics.Deduplicated[_LevelIndex(level)]
+				);
+				_RecordLatency(
+					statistics.CallTime,
+					start
+				);
+				return;
+			}
+		}
+
+		// Context that was discarded because of the severity is written just before the error
+		if (level <= LogLevels::Error)
+		{
+			_BacktraceRing* backtrace = _ActiveBacktrace().load(std::memory_order_acquire);
+			if (backtrace != nullptr)
+			{
+				_DumpBacktrace(
+					*backtrace
+				);
+			}
+		}
+
+		LogRecord record = LogRecord();
+		record.Time = std::chrono::system_clock::now();
+		record.Level = level;
+		record.Module = module;
+		record.Line = line;
+		record.Function = function;
+		record.ThreadId = _CurrentThreadId();
+		record.Template = messageTemplate;
+		record.Category = std::string_view(entry.Name.data(), entry.NameLength);
+		record.Sinks = sinks;
+
+		record.Arguments = arguments;
+		record.Names = names;
+		record.Numeric = numeric;
+		record.ArgumentCount = argumentCount;
+		record.Site = site;
+		uint64_t bytes = _Emit(
+			record
+		);
+		uint64_t nanoseconds = _RecordLatency(
+			statistics.CallTime,
+			start
+		);
+
+		// Every accepted record ends up as exactly one of written, dropped or deduplicated
+		if (bytes == 0ULL)
+		{
+			_Count(
+				statistics.Dropped[_LevelIndex(level)]
+			);
+		}
+
+		// Shared by every thread that logs from the call site, so it is opt-in
+		if (site != nullptr
+			&& CurrentConfiguration().ProfileCallSites == true)
+		{
+			site->Bytes.fetch_add(
+				bytes,
+				std::memory_order_relaxed
+			);
+			site->Nanoseconds.fetch_add(
+				nanoseconds,
+				std::memory_order_relaxed
+			);
+		}
+	};
+	#endif // SIMPLELOG_DEFINE_BACKEND
+
+	#ifdef SIMPLELOG_DEFINE_BACKEND
+	/**
+	* @brief Helper for rollups. Registers the process for expedited memory barriers, so only the thread that closes a window pays for ordering it against the messages that are added (Linux only). Standalone use not supported.
+	* @return True if `_HeavyBarrier` orders the memory accesses of every thread; false if every message has to use a full fence.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API bool _RegisterHeavyBarrier()
+	{
+	#ifdef __linux__
+		static const bool registered = syscall(SYS_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) == 0;
+
+		return registered;
+	#else
+		return false;
+	#endif // __linux__
+	};
+
+	/**
+	* @brief Helper for filters. Resolves the level of a call site whose cached decision is stale. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API LogLevel _ResolveCallSite(
+		const CallSite& site
+	) {
+		return _SiteSeverity(
+			&site,
+			site.Module,
+			site.Function
+		);
+	};
+	#endif // SIMPLELOG_DEFINE_BACKEND
+
+	/**
+	* @brief Helper for rollups. The side of a barrier that is rarely taken: orders the memory accesses of every thread of the process if the process is registered, else a full fence. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _HeavyBarrier(
+		bool asymmetric
+	) {
+	#ifdef __linux__
+		if (asymmetric == true
+			&& syscall(SYS_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0, 0) == 0)
+		{
+			return;
+		}
+	#endif // __linux__
+
+		std::atomic_thread_fence(
+			std::memory_order_seq_cst
+		);
+	};
+
+	/**
+	* @brief Helper for rollups. The part of a call site that only the logger uses. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _RollupShared final
+	{
+	public:
+		std::mutex Mutex = std::mutex();
+		std::vector<_RollupAccumulator*> Threads = std::vector<_RollupAccumulator*>();
+		std::unique_ptr<_RollupValue[]> Values = nullptr;
+		_RollupAccumulator::Slot Retired = _RollupAccumulator::Slot();	///< The counters of the threads that exited during the open window.
+	};
+
+	/**
+	* @brief Helper for rollups. Every rollup call site that has been reached, so open windows can be closed without waiting for the next message. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _RollupRegistry final
+	{
+	public:
+		std::mutex Mutex = std::mutex();
+		std::vector<_RollupSite*> Sites = std::vector<_RollupSite*>();
+	};
+
+	/**
+	* @brief Helper for rollups. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline _RollupRegistry& _RollupSites()
+	{
+		static _RollupRegistry registry = _RollupRegistry();
+
+		return registry;
+	}
+
+	inline void _StartHousekeeping();
+
+	/**
+	* @brief Helper for rollups. Adds the counters of a slot to another slot of the same window. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _RetireRollup(
+		_RollupAccumulator::Slot& target,
+		const _RollupAccumulator::Slot& source,
+		uint64_t window,
+		size_t count
+	) {
+		uint64_t messages = source.Count.load(
+			std::memory_order_relaxed
+		);
+		if (source.Window.load(std::memory_order_relaxed) != window
+			|| messages == 0ULL)
+		{
+			return;
+		}
+
+		bool first = target.Window.load(std::memory_order_relaxed) != window;
+		size_t index = 0ULL;
+		while (index < count)
+		{
+			double minimum = source.Values[index].Minimum.load(std::memory_order_relaxed);
+			double maximum = source.Values[index].Maximum.load(std::memory_order_relaxed);
+			double sum = source.Values[index].Sum.load(std::memory_order_relaxed);
+			if (first == false)
+			{
+				minimum = std::min<double>(minimum, target.Values[index].Minimum.load(std::memory_order_relaxed));
+				maximum = std::max<double>(maximum, target.Values[index].Maximum.load(std::memory_order_relaxed));
+				sum += target.Values[index].Sum.load(std::memory_order_relaxed);
+			}
+
+			target.Values[index].Minimum.store(minimum, std::memory_order_relaxed);
+			target.Values[index].Maximum.store(maximum, std::memory_order_relaxed);
+			target.Values[index].Sum.store(sum, std::memory_order_relaxed);
+			index += 1ULL;
+		}
+
+		target.Count.store(
+			(first == true ? 0ULL : target.Count.load(std::memory_order_relaxed)) + messages,
+			std::memory_order_relaxed
+		);
+		target.Window.store(
+			window,
+			std::memory_order_relaxed
+		);
+	};
+
+	#ifdef SIMPLELOG_DEFINE_BACKEND
+	/**
+	* @brief Helper for rollups. Registers a call site, so the background worker closes its windows. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API void _RegisterRollup(
+		_RollupSite& site
+	) {
+		_RollupShared* shared = new _RollupShared();
+		shared->Values = std::make_unique<_RollupValue[]>(site.ArgumentCount);
+		shared->Retired.Values = shared->Values.get();
+		site.Shared = shared;
+
+		{
+			_RollupRegistry& registry = _RollupSites();
+			std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+				registry.Mutex
+			);
+			registry.Sites.push_back(
+				&site
+			);
+		}
+
+		_StartHousekeeping();
+	};
+
+	/**
+	* @brief Helper for rollups. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API void _UnregisterRollup(
+		_RollupSite& site
+	) {
+		{
+			_RollupRegistry& registry = _RollupSites();
+			std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+				registry.Mutex
+			);
+			std::erase(
+				registry.Sites,
+				&site
+			);
+		}
+
+		delete site.Shared;
+		site.Shared = nullptr;
+	};
+
+	/**
+	* @brief Helper for rollups. Registers the counters of a thread with its call site. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API void _AttachRollup(
+		_RollupSite& site,
+		_RollupAccumulator& accumulator
+	) {
+		std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+			site.Shared->Mutex
+		);
+		site.Shared->Threads.push_back(
+			&accumulator
+		);
+		accumulator.Window = site.Window.load(
+			std::memory_order_relaxed
+		);
+	};
+
+	/**
+	* @brief Helper for rollups. Removes the counters of a thread that exits from its call site; the messages of the open window are kept by the call site. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API void _DetachRollup(
+		_RollupSite& site,
+		_RollupAccumulator& accumulator
+	) {
+		std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+			site.Shared->Mutex
+		);
+		std::erase(
+			site.Shared->Threads,
+			&accumulator
+		);
+
+		const uint64_t open = site.Window.load(
+			std::memory_order_relaxed
+		);
+		_RetireRollup(
+			site.Shared->Retired,
+			accumulator.Slots[open % 2ULL],
+			open,
+			site.ArgumentCount
+		);
+	};
+	#endif // SIMPLELOG_DEFINE_BACKEND
+
+	/**
+	* @brief Helper for rollups. Formats an aggregate without trailing zeros. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline std::string _FormatAggregate(
+		double value,
+		bool integral
+	) {
+		if (integral == true)
+		{
+			return std::to_string(
+				static_cast<long long>(value)
+			);
+		}
+
+		std::string text = std::to_string(
+			value
+		);
+		size_t end = text.find_last_not_of(
+			'0'
+		);
+		if (end != std::string::npos
+			&& text[end] == '.')
+		{
+			end -= 1ULL;
+		}
+
+		text.resize(
+			end + 1ULL
+		);
+		return text;
+	};
+
+	#ifdef SIMPLELOG_DEFINE_BACKEND
+	/**
+	* @brief Helper for rollups. Closes the open window of the call site, merges the counters of all threads and writes the summary. Standalone use not supported.
+	* @param force Closes the window even if it has not passed yet.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	SIMPLELOG_API void _CloseRollup(
+		_RollupSite& site,
+		int64_t now,
+		bool force
+	) {
+		const size_t count = site.ArgumentCount;
+		std::unique_ptr<_RollupValue[]> values = std::make_unique<_RollupValue[]>(count);
+		_RollupAccumulator::Slot merged = _RollupAccumulator::Slot();
+		merged.Values = values.get();
+		uint64_t closing = 0ULL;
+		{
+			_RollupShared& shared = *site.Shared;
+			std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+				shared.Mutex
+			);
+			if (force == false
+				&& now < site.Deadline.load(std::memory_order_relaxed))
+			{
+				// Another thread closed this window
+				return;
+			}
+
+			site.Deadline.store(
+				now + site.Length,
+				std::memory_order_relaxed
+			);
+			closing = site.Window.fetch_add(
+				1ULL,
+				std::memory_order_relaxed
+			);
+
+			// Every thread either sees the new window or has marked its slot busy before the slot is read
+			_HeavyBarrier(
+				site.Asymmetric
+			);
+			for (_RollupAccumulator* accumulator : shared.Threads)
+			{
+				// A thread that has seen the window before it was closed finishes its message first
+				_RollupAccumulator::Slot& slot = accumulator->Slots[closing % 2ULL];
+				while (slot.Busy.load(std::memory_order_acquire) == true)
+				{
+					std::this_thread::yield();
+				}
+
+				_RetireRollup(
+					merged,
+					slot,
+					closing,
+					count
+				);
+			}
+
+			_RetireRollup(
+				merged,
+				shared.Retired,
+				closing,
+				count
+			);
+		}
+
+		uint64_t total = merged.Count.load(
+			std::memory_order_relaxed
+		);
+		if (merged.Window.load(std::memory_order_relaxed) != closing
+			|| total == 0ULL)
+		{
+			return;
+		}
+
+		site.Site.Hits.fetch_add(
+			total,
+			std::memory_order_relaxed
+		);
+		if (_HasOutput() == false)
+		{
+			return;
+		}
+
+		// Numeric placeholders show their aggregates, all others a '*'
+		std::vector<std::string> arguments = std::vector<std::string>(count + 1ULL);
+		size_t index = 0ULL;
+		while (index < count)
+		{
+			if (site.Kinds[index] == 0)
+			{
+				arguments[index] = "*";
+			}
+			else
+			{
+				bool integral = site.Kinds[index] == 1;
+				double sum = merged.Values[index].Sum.load(std::memory_order_relaxed);
+				arguments[index] = "[min ";
+				arguments[index] += _FormatAggregate(merged.Values[index].Minimum.load(std::memory_order_relaxed), integral);
+				arguments[index] += ", avg ";
+				arguments[index] += _FormatAggregate(sum / static_cast<double>(total), false);
+				arguments[index] += ", max ";
+				arguments[index] += _FormatAggregate(merged.Values[index].Maximum.load(std::memory_order_relaxed), integral);
+				arguments[index] += ", sum ";
+				arguments[index] += _FormatAggregate(sum, integral);
+				arguments[index] += "]";
+			}
+
+			index += 1ULL;
+		}
+
+		std::string summary = std::string(site.Site.Template);
+		summary += " (rolled up {rolledUp} messages)";
+		arguments[count] = std::to_string(
+			total
+		);
+		std::vector<std::string_view> names = std::vector<std::string_view>(count + 1ULL);
+		names[count] = "rolledUp";
+		std::unique_ptr<bool[]> numeric = std::make_unique<bool[]>(count + 1ULL);
+		numeric[count] = true;
+
+		LogRecord record = LogRecord();
+		record.Time = std::chrono::system_clock::now();
+		record.Level = site.Site.Level;
+		record.Module = site.Site.Module;
+		record.Line = site.Site.Line;
+		record.Function = site.Site.Function;
+		record.Template = summary;
+		record.Arguments = arguments.data();
+		record.Names = names.data();
+		record.Numeric = numeric.get();
+		record.ArgumentCount = count + 1ULL;
+		_Emit(
+			record
+		);
+	};
+	#endif // SIMPLELOG_DEFINE_BACKEND
+
+	/**
+	* @brief Helper for rollups. Closes the windows of every rollup call site that have passed. Standalone use not supported.
+	* @param force Closes every open window, whether it has passed or not.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _CloseRollups(
+		bool force
+	) {
+		const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()
+		).count();
+		_RollupRegistry& registry = _RollupSites();
+		std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+			registry.Mutex
+		);
+		for (_RollupSite* site : registry.Sites)
+		{
+			if (force == true
+				|| now >= site->Deadline.load(std::memory_order_relaxed))
+			{
+				_CloseRollup(
+					*site,
+					now,
+					force
+				);
+			}
+		}
+	};
+
+
+	/**
+	* @brief The compile-time policies of a `Logger`. A logger only contains the code of the policies it is given.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	namespace Policies
+	{
+		/**
+		* @brief Writes every line to the console, with the level column colored.
+		*/
+		struct ConsoleSink final
+		{
+		public:
+			static constexpr uint8_t Sinks = CategorySinks::Console;
+		};
+
+		/**
+		* @brief Appends every line to the daily log file in the log directory of the logger.
+		*/
+		struct FileSink final
+		{
+		public:
+			static constexpr uint8_t Sinks = CategorySinks::File;
+		};
+
+		/**
+		* @brief Appends every record as a JSON object to the daily JSON Lines file in the log directory of the logger.
+		*/
+		struct JsonFileSink final
+		{
+		public:
+			static constexpr uint8_t Sinks = CategorySinks::JsonFile;
+		};
+
+		/**
+		* @brief Writes the time of a record in seconds (`HH:MM:SS`), which is the default.
+		*/
+		struct SecondTimestamps final
+		{
+		public:
+			static constexpr std::string_view Timestamp = std::string_view("%T");
+		};
+
+		/**
+		* @brief Writes the time of a record in milliseconds (`HH:MM:SS.mmm`).
+		*/
+		struct MillisecondTimestamps final
+		{
+		public:
+			static constexpr std::string_view Timestamp = std::string_view("%T.%e");
+		};
+
+		/**
+		* @brief Writes the time of a record in microseconds (`HH:MM:SS.uuuuuu`).
+		*/
+		struct MicrosecondTimestamps final
+		{
+		public:
+			static constexpr std::string_view Timestamp = std::string_view("%T.%u");
+		};
+
+		/**
+		* @brief Writes the id of the logging thread into every record.
+		*/
+		struct WithThreadId final
+		{ };
+
+		/**
+		* @brief Does not lock at all, for loggers that are only used by a single thread.
+		*/
+		struct NoLocking final
+		{
+		public:
+			inline void lock()
+			{ };
+
+			inline void unlock()
+			{ };
+		};
+
+		/**
+		* @brief Serializes the writes of all threads with a mutex, which is the default. Any other type with `lock()` and `unlock()` can be used as well.
+		*/
+		using MutexLocking = std::mutex;
+	}
+
+	/**
+	* @brief Helper for policy loggers. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <typename TPolicy>
+	concept _SinkPolicy = requires
+	{
+		{ TPolicy::Sinks } -> std::convertible_to<uint8_t>;
+	};
+
+	/**
+	* @brief Helper for policy loggers. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <typename TPolicy>
+	concept _TimestampPolicy = requires
+	{
+		{ TPolicy::Timestamp } -> std::convertible_to<std::string_view>;
+	};
+
+	/**
+	* @brief Helper for policy loggers. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <typename TPolicy>
+	concept _LockingPolicy = requires (TPolicy& lock)
+	{
+		lock.lock();
+		lock.unlock();
+	};
+
+	/**
+	* @brief Helper for policy loggers. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <typename TPolicy>
+	concept _LoggerPolicy = _SinkPolicy<TPolicy>
+							|| _TimestampPolicy<TPolicy>
+							|| _LockingPolicy<TPolicy>
+							|| std::same_as<TPolicy, Policies::WithThreadId>;
+
+	/**
+	* @brief Helper for policy loggers. Finds the locking policy or uses the mutex if none is given. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <typename... TPolicies>
+	struct _LockOf final
+	{
+	public:
+		using Type = Policies::MutexLocking;
+	};
+
+	/**
+	* @brief Helper for policy loggers. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <typename TPolicy, typename... TPolicies>
+	struct _LockOf<TPolicy, TPolicies...> final
+	{
+	public:
+		using Type = std::conditional_t<_LockingPolicy<TPolicy>, TPolicy, typename _LockOf<TPolicies...>::Type>;
+	};
+
+	/**
+	* @brief Helper for policy loggers. The outputs of a single policy. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <typename TPolicy>
+	constexpr uint8_t _SinksOf()
+	{
+		if constexpr (_SinkPolicy<TPolicy> == true)
+		{
+			return TPolicy::Sinks;
+		}
+		else
+		{
+			return CategorySinks::None;
+		}
+	}
+
+	/**
+	* @brief Helper for policy loggers. The timestamp of a single policy. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <typename TPolicy>
+	constexpr std::string_view _TimestampOf(
+		std::string_view timestamp
+	) {
+		if constexpr (_TimestampPolicy<TPolicy> == true)
+		{
+			return TPolicy::Timestamp;
+		}
+		else
+		{
+			return timestamp;
+		}
+	}
+
+	/**
+	* @brief Helper for policy loggers. Builds the layout of the default pattern with the given timestamp and optionally the thread id. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	constexpr Layout _PolicyLayout(
+		std::string_view timestamp,
+		bool threadId
+	) {
+		std::array<char, 64ULL> pattern = { };
+		size_t length = 0ULL;
+		auto append = [&](std::string_view text)
+		{
+			for (char character : text)
+			{
+				pattern[length] = character;
+				length += 1ULL;
+			}
+		};
+
+		append(timestamp);
+		append("\t\t[%-12L]\t\t");
+		if (threadId == true)
+		{
+			append("Thread #%t\t\t");
+		}
+
+		append("%-64S\t\t%-32f\t\t%m");
+		return Layout(
+			std::string_view(pattern.data(), length)
+		);
+	}
+
+	/**
+	* @brief Helper for policy loggers. Everything a logger derives from its policies at compile time. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <typename... TPolicies>
+	struct _LoggerPolicies final
+	{
+	public:
+		static_assert((_LoggerPolicy<TPolicies> && ...), "Unknown logger policy.");
+		static_assert(((_SinkPolicy<TPolicies> == true ? 1 : 0) + ...) > 0, "A logger needs at least one sink policy.");
+		static_assert(((_TimestampPolicy<TPolicies> == true ? 1 : 0) + ...) <= 1, "A logger takes at most one timestamp policy.");
+		static_assert(((_LockingPolicy<TPolicies> == true ? 1 : 0) + ...) <= 1, "A logger takes at most one locking policy.");
+
+		static constexpr uint8_t Sinks = (_SinksOf<TPolicies>() | ...);
+		static constexpr bool Console = (Sinks & CategorySinks::Console) != 0U;
+		static constexpr bool File = (Sinks & CategorySinks::File) != 0U;
+		static constexpr bool JsonFile = (Sinks & CategorySinks::JsonFile) != 0U;
+		static constexpr bool ThreadId = (std::same_as<TPolicies, Policies::WithThreadId> || ...);
+		static constexpr Layout Columns = _PolicyLayout(
+			[]()
+			{
+				std::string_view timestamp = Policies::SecondTimestamps::Timestamp;
+				((timestamp = _TimestampOf<TPolicies>(timestamp)), ...);
+				return timestamp;
+			}(),
+			ThreadId
+		);
+
+		using Lock = typename _LockOf<TPolicies...>::Type;
+	};
+
+	/**
+	* @brief Helper for policy loggers. The daily log file of a logger, which stays open until the day changes or the logger is configured again (Linux only). Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _LoggerFile final
+	{
+	public:
+		_LoggerFile() = default;
+
+		_LoggerFile(const _LoggerFile&) = delete;
+		_LoggerFile& operator=(const _LoggerFile&) = delete;
+
+		~_LoggerFile()
+		{
+		#ifdef __linux__
+			if (this->Descriptor >= 0)
+			{
+				close(this->Descriptor);
+			}
+		#endif // __linux__
+		};
+
+		int Descriptor = -1;
+		int Day = -1;
+	};
+
+	/**
+	* @brief Helper for policy loggers. Takes the place of the files of a logger without file outputs. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _NoLoggerFile final
+	{ };
+
+	/**
+	* @brief Helper for policy loggers. Appends a line to the daily log file of a logger. Standalone use not supported.
+	* @return True if the line was written.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline bool _AppendLoggerFile(
+		_LoggerFile& file,
+		const std::filesystem::path& directory,
+		std::string_view prefix,
+		std::string_view postfix,
+		const std::tm& tm,
+		std::string_view extension,
+		std::string_view line
+	) {
+	#ifdef __linux__
+		const int day = tm.tm_year * 1000 + tm.tm_yday;
+		if (file.Descriptor < 0
+			|| file.Day != day)
+		{
+			if (file.Descriptor >= 0)
+			{
+				close(file.Descriptor);
+			}
+
+			file.Descriptor = open(
+				_LogFilePath(directory, prefix, postfix, tm, extension).c_str(),
+				O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC,
+				0644
+			);
+			file.Day = day;
+		}
+
+		if (file.Descriptor < 0)
+		{
+			return false;
+		}
+
+		_WriteAll(
+			file.Descriptor,
+			line.data(),
+			line.size()
+		);
+		return true;
+	#else
+		static_cast<void>(file);
+		std::ofstream stream(
+			_LogFilePath(directory, prefix, postfix, tm, extension),
+			std::ios_base::out | std::ios_base::app
+		);
+		if (stream.is_open() == false)
+		{
+			return false;
+		}
+
+		stream << line;
+		return true;
+	#endif // __linux__
+	};
+
+	/**
+	* @brief Helper for policy loggers. Everything a logger instance needs while it writes. The block starts on a cache line of its own and is padded to whole cache lines, so two loggers that are busy on different threads never share a cache line. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <typename... TPolicies>
+	struct alignas(64) _LoggerState final
+	{
+	private:
+		using _Policies = _LoggerPolicies<TPolicies...>;
+
+	public:
+		std::atomic<LogSeverity> Severity = LogSeverity::Disabled;	///< The only value that is read without the lock.
+		[[no_unique_address]] typename _Policies::Lock Lock = typename _Policies::Lock();
+		std::filesystem::path Directory = std::filesystem::path();
+		std::string Prefix = std::string();
+		std::string Postfix = std::string();
+		std::string Line = std::string();		///< Reused by every record, so composing does not allocate after warm-up.
+		[[no_unique_address]] std::conditional_t<_Policies::File, _LoggerFile, _NoLoggerFile> File;
+		[[no_unique_address]] std::conditional_t<_Policies::JsonFile, _LoggerFile, _NoLoggerFile> Json;
+	};
+
+	/**
+	* @brief A logger instance whose outputs, timestamp precision, thread id and locking are chosen at compile time, e.g. `Logger<Policies::FileSink, Policies::NoLocking>`.
+	*
+	* Only the code of the given policies is compiled in, everything the runtime configuration would otherwise have to check is left out.
+	* Every instance has its own configuration, files and buffer and is independent of `ConfigureLogger` and of every other instance.
+	* Of the configuration only `LogDirectory`, `Severity`, `FileNamePrefix` and `FileNamePostfix` are used; a policy logger writes the default columns and knows nothing of categories, filters, scopes, the flight recorder or the statistics.
+	* The call sites of the instance macros are registered like every other call site, and their state (`SetCallSiteState`) applies to every instance they write to.
+	* Without policies (`DefaultLogger`) the logger is not an instance of its own but writes through the logger configured with `ConfigureLogger`, exactly like the logging macros.
+	*
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <typename... TPolicies>
+	struct Logger final
+	{
+	private:
+		using _Policies = _LoggerPolicies<TPolicies...>;
+
+	public:
+		explicit Logger(
+			const LoggerConfiguration& configuration = LoggerConfiguration()
+		) {
+			this->Configure(
+				configuration
+			);
+		};
+
+		Logger(const Logger&) = delete;
+		Logger& operator=(const Logger&) = delete;
+
+		~Logger() = default;
+
+		/**
+		* @brief Changes the configuration of this logger. Calls that are writing at the same time finish with the previous configuration.
+		* @param configuration The configuration, of which `LogDirectory`, `Severity`, `FileNamePrefix` and `FileNamePostfix` are used.
+		*/
+		inline void Configure(
+			const LoggerConfiguration& configuration
+		) {
+			std::lock_guard<typename _Policies::Lock> lock = std::lock_guard<typename _Policies::Lock>(
+				m_State.Lock
+			);
+			m_State.Directory = configuration.LogDirectory;
+			m_State.Prefix = configuration.FileNamePrefix;
+			m_State.Postfix = configuration.FileNamePostfix;
+
+			// The files are reopened with the new names by the next record
+			if constexpr (_Policies::File == true)
+			{
+				m_State.File.Day = -1;
+			}
+
+			if constexpr (_Policies::JsonFile == true)
+			{
+				m_State.Json.Day = -1;
+			}
+
+			m_State.Severity.store(
+				configuration.Severity,
+				std::memory_order_relaxed
+			);
+		};
+
+		/**
+		* @brief Writes a message with variable arguments to the outputs of the logger.
+		* @param level The LogLevel of the message.
+		* @param module The name of the module that generated the message.
+		* @param line The line number where in the module the log is happening.
+		* @param function The name of the function that generated the message.
+		* @param arguments The variable arguments to pass to the formatting function.
+		*/
+		template <StringLiteral STemplate, _Loggable... TArguments>
+			requires (PlaceholderCountMatchesArgumentCount<STemplate, TArguments...>())
+		inline void Write(
+			const LogLevel level,
+			std::string_view module,
+			std::string_view line,
+			std::string_view function,
+			TArguments&&... arguments
+		) {
+			if (level <= LogLevel(m_State.Severity.load(std::memory_order_relaxed))) [[unlikely]]
+			{
+				this->Capture(
+					nullptr,
+					level,
+					module,
+					line,
+					function,
+					std::string_view(STemplate.Value, sizeof(STemplate.Value) - 1ULL), // Exclude \0 character
+					std::forward<TArguments>(arguments)...
+				);
+			}
+		};
+
+		/**
+		* @brief Writes a message from a call site with variable arguments to the outputs of the logger. This is what the instance macros use.
+		* @param site The call site, which has to have static storage duration. A disabled call site never writes, an enabled one always.
+		* @param arguments The variable arguments to pass to the formatting function.
+		*/
+		template <StringLiteral STemplate, _Loggable... TArguments>
+			requires (PlaceholderCountMatchesArgumentCount<STemplate, TArguments...>())
+		inline void Write(
+			const CallSite& site,
+			TArguments&&... arguments
+		) {
+			const CallSiteState state = site.State.load(
+				std::memory_order_relaxed
+			);
+			if (state == CallSiteState::Enabled
+				|| (state == CallSiteState::Default
+					&& site.Level <= LogLevel(m_State.Severity.load(std::memory_order_relaxed)))) [[unlikely]]
+			{
+				site.Hits.fetch_add(
+					1ULL,
+					std::memory_order_relaxed
+				);
+				this->Capture(
+					&site,
+					site.Level,
+					site.Module,
+					site.Line,
+					site.Function,
+					std::string_view(STemplate.Value, sizeof(STemplate.Value) - 1ULL), // Exclude \0 character
+					std::forward<TArguments>(arguments)...
+				);
+			}
+		};
+
+	private:
+		_LoggerState<TPolicies...> m_State;
+
+		// Formats the arguments of an enabled call, which is the only part that depends on the argument types
+		template <typename... TArguments>
+		SIMPLELOG_COLD inline void Capture(
+			const CallSite* site,
+			const LogLevel level,
+			std::string_view module,
+			std::string_view line,
+			std::string_view function,
+			std::string_view messageTemplate,
+			TArguments&&... arguments
+		) {
+			_ArgumentFrame<sizeof...(TArguments)> frame = _ArgumentFrame<sizeof...(TArguments)>();
+			std::array<std::string, sizeof...(TArguments)>& unrolledArguments = frame.Strings;
+			std::array<std::string_view, sizeof...(TArguments)> names = { };
+			std::array<bool, sizeof...(TArguments)> numeric = { };
+			UnrollArguments(
+				unrolledArguments,
+				std::forward_as_tuple(
+					arguments...
+				),
+				std::make_index_sequence<sizeof...(TArguments)>()
+			);
+			if constexpr (_Policies::JsonFile == true)
+			{
+				size_t index = 0ULL;
+				static_cast<void>(((DescribeArgument(
+					names[index],
+					numeric[index],
+					arguments
+				), index += 1ULL), ...));
+			}
+
+			LogRecord record = LogRecord();
+			record.Time = std::chrono::system_clock::now();
+			record.Level = level;
+			record.Module = module;
+			record.Line = line;
+			record.Function = function;
+			if constexpr (_Policies::ThreadId == true)
+			{
+				record.ThreadId = _CurrentThreadId();
+			}
+
+			record.Template = messageTemplate;
+			record.Sinks = _Policies::Sinks;
+			record.Arguments = unrolledArguments.data();
+			record.Names = names.data();
+			record.Numeric = numeric.data();
+			record.ArgumentCount = sizeof...(TArguments);
+			record.Site = site;
+			this->Emit(
+				record
+			);
+		};
+
+		// Writes a record to the outputs of the policies; the arguments are already formatted, so nothing under the lock can log
+		inline void Emit(
+			const LogRecord& record
+		) {
+			std::tm tm = _LocalTime(
+				record.Time
+			);
+			std::lock_guard<typename _Policies::Lock> lock = std::lock_guard<typename _Policies::Lock>(
+				m_State.Lock
+			);
+			std::string& line = m_State.Line;
+			if constexpr (_Policies::Console == true
+						  || _Policies::File == true)
+			{
+				line.clear();
+				size_t levelBegin = std::string::npos;
+				size_t levelEnd = std::string::npos;
+				_ComposeLine(
+					_Policies::Columns,
+					record,
+					tm,
+					line,
+					levelBegin,
+					levelEnd
+				);
+				line += '\n';
+				if constexpr (_Policies::Console == true)
+				{
+					_WriteConsole(
+						line,
+						record.Level,
+						levelBegin,
+						levelEnd
+					);
+				}
+
+				if constexpr (_Policies::File == true)
+				{
+					if (m_State.Directory.empty() == false)
+					{
+						_AppendLoggerFile(
+							m_State.File,
+							m_State.Directory,
+							m_State.Prefix,
+							m_State.Postfix,
+							tm,
+							".log",
+							line
+						);
+					}
+				}
+			}
+
+			if constexpr (_Policies::JsonFile == true)
+			{
+				if (m_State.Directory.empty() == false)
+				{
+					line.clear();
+					_ComposeJson(
+						record,
+						line
+					);
+					_AppendLoggerFile(
+						m_State.Json,
+						m_State.Directory,
+						m_State.Prefix,
+						m_State.Postfix,
+						tm,
+						".jsonl",
+						line
+					);
+				}
+			}
+		};
+	};
+
+	/**
+	* @brief The logger configured with `ConfigureLogger`, which is what the logging macros write to. Every feature is chosen at runtime.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <>
+	struct Logger<> final
+	{
+	public:
+		/**
+		* @brief Configures the global logger, like `ConfigureLogger`.
+		*/
+		inline void Configure(
+			const LoggerConfiguration& configuration
+		) {
+			ConfigureLogger(
+				configuration
+			);
+		};
+
+		/**
+		* @brief Writes a message with variable arguments, like `WriteLog`.
+		*/
+		template <StringLiteral STemplate, _Loggable... TArguments>
+			requires (PlaceholderCountMatchesArgumentCount<STemplate, TArguments...>())
+		inline void Write(
+			const LogLevel level,
+			std::string_view module,
+			std::string_view line,
+			std::string_view function,
+			TArguments&&... arguments
+		) {
+			_WriteLog<STemplate>(
+				nullptr,
+				level,
+				module,
+				line,
+				function,
+				std::forward<TArguments>(arguments)...
+			);
+		};
+
+		/**
+		* @brief Writes a message from a call site with variable arguments, like `WriteLog`.
+		*/
+		template <StringLiteral STemplate, _Loggable... TArguments>
+			requires (PlaceholderCountMatchesArgumentCount<STemplate, TArguments...>())
+		inline void Write(
+			const CallSite& site,
+			TArguments&&... arguments
+		) {
+			WriteLog<STemplate>(
+				site,
+				std::forward<TArguments>(arguments)...
+			);
+		};
+	};
+
+	/**
+	* @brief The logger with every feature chosen at runtime by `LoggerConfiguration`.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	using DefaultLogger = Logger<>;
+
+	/**
+	* @brief The global default instance: the logger configured with `ConfigureLogger`, which the logging macros write to.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline DefaultLogger& GlobalLogger()
+	{
+		static DefaultLogger logger = DefaultLogger();
+
+		return logger;
+	}
+
+	/**
+	* @brief Helper for the instance macros. Writes a message from a call site to any logger, also if the type of the logger is dependent. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	template <StringLiteral STemplate, typename TLogger, _Loggable... TArguments>
+		requires (PlaceholderCountMatchesArgumentCount<STemplate, TArguments...>())
+	inline void _WriteTo(
+		TLogger& logger,
+		const CallSite& site,
+		TArguments&&... arguments
+	) {
+		logger.template Write<STemplate>(
+			site,
+			std::forward<TArguments>(arguments)...
+		);
+	};
+
+	// Logging functions for a logger instance (e.g. LogWarningTo(logger, "...")); LogWarningTo(SimpleLog::GlobalLogger(), "...") is the same as LogWarning("...")
+	#define LogAtTo(logger, level, template, ...) SimpleLog::_WriteTo<template>(logger, CALL_SITE_OF(level, template) __VA_OPT__(,) __VA_ARGS__)
+	#define LogTraceTo(logger, template, ...) LogAtTo(logger, Trace, template __VA_OPT__(,) __VA_ARGS__)
+	#define LogDebugTo(logger, template, ...) LogAtTo(logger, Debug, template __VA_OPT__(,) __VA_ARGS__)
+	#define LogInformationTo(logger, template, ...) LogAtTo(logger, Information, template __VA_OPT__(,) __VA_ARGS__)
+	#define LogWarningTo(logger, template, ...) LogAtTo(logger, Warning, template __VA_OPT__(,) __VA_ARGS__)
+	#define LogErrorTo(logger, template, ...) LogAtTo(logger, Error, template __VA_OPT__(,) __VA_ARGS__)
+	#define LogCriticalTo(logger, template, ...) LogAtTo(logger, Critical, template __VA_OPT__(,) __VA_ARGS__)
+
+#ifdef __linux__
+	/**
+	* @brief Helper for the background worker. A descriptor the worker waits on and what to do once it is readable. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _WorkerDescriptor final
+	{
+	public:
+		int Descriptor = -1;
+		std::function<void()> Ready = std::function<void()>();
+	};
+
+	/**
+	* @brief Helper for the background worker. The single thread that does all the work the logging path must never do (watching files, serving sockets). Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _BackgroundWorker final
+	{
+	public:
+		~_BackgroundWorker()
+		{
+			if (this->Thread.joinable() == true)
+			{
+				this->Stopping.store(
+					true,
+					std::memory_order_relaxed
+				);
+				char wake = 0;
+				static_cast<void>(write(this->Wake[1], &wake, 1ULL));
+				this->Thread.join();
+			}
+
+			if (this->Wake[0] >= 0)
+			{
+				close(this->Wake[0]);
+				close(this->Wake[1]);
+			}
+		};
+
+		std::mutex Mutex = std::mutex();
+		std::mutex Dispatching = std::mutex();	///< Held while callbacks run, so a removed descriptor is never used afterwards.
+		std::vector<_WorkerDescriptor> Descriptors = std::vector<_WorkerDescriptor>();
+		uint64_t Version = 0ULL;				///< Changes whenever a descriptor is removed.
+		std::thread Thread = std::thread();
+		std::atomic<bool> Stopping = false;
+		int Wake[2] = { -1, -1 };	///< A pipe that interrupts the wait whenever the descriptors change.
+	};
+
+	/**
+	* @brief Helper for the background worker. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline _BackgroundWorker& _Worker()
+	{
+		// The callbacks write records, so the statistics of the worker thread are merged when it is joined
+		static_cast<void>(_Statistics());
+		static _BackgroundWorker worker = _BackgroundWorker();
+
+		return worker;
+	}
+
+	/**
+	* @brief Helper for the background worker. Waits for any descriptor to become readable and runs its callback. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _RunWorker(
+		_BackgroundWorker& worker
+	) {
+		std::vector<pollfd> descriptors = std::vector<pollfd>();
+		std::vector<std::function<void()>> callbacks = std::vector<std::function<void()>>();
+		uint64_t version = 0ULL;
+		while (worker.Stopping.load(std::memory_order_relaxed) == false)
+		{
+			descriptors.clear();
+			callbacks.clear();
+			descriptors.push_back(
+				pollfd{ worker.Wake[0], POLLIN, 0 }
+			);
+			{
+				std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+					worker.Mutex
+				);
+				version = worker.Version;
+				for (const _WorkerDescriptor& descriptor : worker.Descriptors)
+				{
+					descriptors.push_back(
+						pollfd{ descriptor.Descriptor, POLLIN, 0 }
+					);
+					callbacks.push_back(
+						descriptor.Ready
+					);
+				}
+			}
+
+			if (poll(descriptors.data(), descriptors.size(), -1) < 0)
+			{
+				continue;
+			}
+
+			if ((descriptors[0].revents & POLLIN) != 0)
+			{
+				char buffer[64];
+				static_cast<void>(read(worker.Wake[0], buffer, sizeof(buffer)));
+			}
+
+			// Descriptors that were removed while waiting might already be closed
+			std::lock_guard<std::mutex> dispatching = std::lock_guard<std::mutex>(
+				worker.Dispatching
+			);
+			size_t index = 1ULL;
+			while (index < descriptors.size())
+			{
+				{
+					std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+						worker.Mutex
+					);
+					if (worker.Version != version)
+					{
+						break;
+					}
+				}
+
+				if ((descriptors[index].revents & (POLLIN | POLLHUP | POLLERR)) != 0)
+				{
+					callbacks[index - 1ULL]();
+				}
+
+				index += 1ULL;
+			}
+		}
+	};
+
+	/**
+	* @brief Helper for the background worker. Interrupts the current wait, so changed descriptors are picked up. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _WakeWorker(
+		_BackgroundWorker& worker
+	) {
+		char wake = 0;
+		static_cast<void>(write(worker.Wake[1], &wake, 1ULL));
+	};
+
+	/**
+	* @brief Helper for the background worker. Lets the worker run the callback whenever the descriptor is readable. Starts the worker if it is not running yet. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _AddWorkerDescriptor(
+		int descriptor,
+		std::function<void()> ready
+	) {
+		_BackgroundWorker& worker = _Worker();
+		std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+			worker.Mutex
+		);
+		if (worker.Thread.joinable() == false)
+		{
+			if (pipe2(worker.Wake, O_CLOEXEC | O_NONBLOCK) != 0)
+			{
+				return;
+			}
+
+			worker.Thread = std::thread(
+				_RunWorker,
+				std::ref(worker)
+			);
+		}
+
+		_WorkerDescriptor entry = _WorkerDescriptor();
+		entry.Descriptor = descriptor;
+		entry.Ready = std::move(ready);
+		worker.Descriptors.push_back(
+			std::move(entry)
+		);
+		_WakeWorker(
+			worker
+		);
+	};
+
+	/**
+	* @brief Helper for the background worker. Stops waiting on the descriptor. Once this returns the callback does not run anymore and the caller can close the descriptor. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _RemoveWorkerDescriptor(
+		int descriptor
+	) {
+		_BackgroundWorker& worker = _Worker();
+		{
+			std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+				worker.Mutex
+			);
+			std::erase_if(
+				worker.Descriptors,
+				[descriptor](const _WorkerDescriptor& entry)
+				{
+					return entry.Descriptor == descriptor;
+				}
+			);
+			worker.Version += 1ULL;
+			if (worker.Thread.joinable() == false)
+			{
+				return;
+			}
+
+			_WakeWorker(
+				worker
+			);
+		}
+
+		// Callbacks remove their own descriptor while they are dispatched
+		if (std::this_thread::get_id() != worker.Thread.get_id())
+		{
+			std::lock_guard<std::mutex> dispatching = std::lock_guard<std::mutex>(
+				worker.Dispatching
+			);
+		}
+	};
+#endif // __linux__
+
+	/**
+	* @brief Helper for configuration files. The settings read from a configuration file; only the settings given in the file are changed. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _FileSettings final
+	{
+	public:
+		bool HasLevel = false;
+		LogLevel Level = LogLevels::Disabled;
+		bool HasFilter = false;
+		std::vector<_FilterRule> Rules = std::vector<_FilterRule>();
+		bool HasPattern = false;
+		std::string Pattern = std::string();
+		bool HasOutputs = false;
+		uint8_t Outputs = CategorySinks::All;
+		std::vector<std::pair<std::string, LogLevel>> Categories = std::vector<std::pair<std::string, LogLevel>>();
+	};
+
+	/**
+	* @brief Helper for configuration files. Parses the complete file before anything is applied. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline _FileSettings _ParseConfigurationFile(
+		std::istream& input
+	) {
+		_FileSettings settings = _FileSettings();
+		auto trim = [](std::string_view value) -> std::string_view
+		{
+			size_t begin = value.find_first_not_of(" \t\r");
+			if (begin == std::string_view::npos)
+			{
+				return std::string_view();
+			}
+
+			size_t end = value.find_last_not_of(" \t\r");
+			return value.substr(begin, end - begin + 1ULL);
+		};
+		auto parseLevel = [](std::string_view value) -> LogLevel
+		{
+			std::vector<_FilterRule> rules = _CompileFilter(
+				value
+			);
+			if (rules.size() != 1ULL
+				|| rules[0].Pattern.empty() == false)
+			{
+				throw std::invalid_argument(
+					"Expected a single level."
+				);
+			}
+
+			return rules[0].Level;
+		};
+
+		std::string line = std::string();
+		while (std::getline(input, line))
+		{
+			std::string_view entry = trim(line);
+			if (entry.empty() == true
+				|| entry[0] == '#')
+			{
+				continue;
+			}
+
+			size_t equals = entry.find(
+				'='
+			);
+			if (equals == std::string_view::npos)
+			{
+				throw std::invalid_argument(
+					"Expected 'key = value'."
+				);
+			}
+
+			std::string_view key = trim(entry.substr(0ULL, equals));
+			std::string_view value = trim(entry.substr(equals + 1ULL));
+			if (key == "level")
+			{
+				settings.HasLevel = true;
+				settings.Level = parseLevel(
+					value
+				);
+			}
+			else if (key == "filter")
+			{
+				settings.HasFilter = true;
+				settings.Rules = _CompileFilter(
+					value
+				);
+			}
+			else if (key == "pattern")
+			{
+				// Compiled once to reject invalid patterns before anything is applied
+				settings.HasPattern = true;
+				settings.Pattern = value;
+				static_cast<void>(Layout(settings.Pattern));
+			}
+			else if (key == "outputs")
+			{
+				settings.HasOutputs = true;
+				settings.Outputs = CategorySinks::None;
+				while (value.empty() == false)
+				{
+					size_t comma = value.find(
+						','
+					);
+					std::string_view output = trim(value.substr(0ULL, comma));
+					value = comma == std::string_view::npos ? std::string_view() : value.substr(comma + 1ULL);
+					if (output == "console")
+					{
+						settings.Outputs |= CategorySinks::Console;
+					}
+					else if (output == "file")
+					{
+						settings.Outputs |= CategorySinks::File;
+					}
+					else if (output == "json")
+					{
+						settings.Outputs |= CategorySinks::JsonFile;
+					}
+					else if (output != "none")
+					{
+						throw std::invalid_argument(
+							"Unknown output."
+						);
+					}
+				}
+			}
+			else if (key.starts_with("category.") == true)
+			{
+				settings.Categories.emplace_back(
+					std::string(key.substr(9ULL)),
+					parseLevel(value)
+				);
+			}
+			else
+			{
+				throw std::invalid_argument(
+					"Unknown key."
+				);
+			}
+		}
+
+		return settings;
+	};
+
+	/**
+	* @brief Helper for configuration files. Applies the settings as a single new snapshot: call sites resolve their level again only after everything has been applied. Settings that are missing from the file fall back to the configuration. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _ApplyFileSettings(
+		_FileSettings& settings
+	) {
+		// What the previous file changed, so settings removed from the file are reverted
+		static std::vector<std::string> fileCategories = std::vector<std::string>();
+		static bool filePattern = false;
+
+		_Filter& filter = _CurrentFilter();
+		_CategoryTable& table = _Categories();
+		std::lock_guard<std::mutex> filterLock = std::lock_guard<std::mutex>(
+			filter.Mutex
+		);
+		std::lock_guard<std::mutex> categoryLock = std::lock_guard<std::mutex>(
+			table.Mutex
+		);
+		if (settings.HasFilter == false)
+		{
+			settings.Rules = _CompileFilter(
+				_FilterSpec(CurrentConfiguration())
+			);
+		}
+
+		const std::vector<_FilterRule>* rules = _PublishFilterRules(
+			filter,
+			std::move(settings.Rules)
+		);
+
+		// The level and outputs of the file are the ones of the root category
+		table.Categories[0].Level.store(
+			settings.HasLevel == true ? static_cast<uint8_t>(static_cast<LogSeverity>(settings.Level)) : _Category::Inherit,
+			std::memory_order_relaxed
+		);
+		table.Categories[0].Sinks.store(
+			settings.HasOutputs == true ? settings.Outputs : _Category::Inherit,
+			std::memory_order_relaxed
+		);
+		for (const std::string& name : fileCategories)
+		{
+			size_t index = _RegisterCategory(
+				table,
+				name,
+				HashCategory(name)
+			);
+			if (index > 0ULL)
+			{
+				table.Categories[index].Level.store(
+					_Category::Inherit,
+					std::memory_order_relaxed
+				);
+			}
+		}
+
+		fileCategories.clear();
+		for (const std::pair<std::string, LogLevel>& category : settings.Categories)
+		{
+			size_t index = _RegisterCategory(
+				table,
+				category.first,
+				HashCategory(category.first)
+			);
+			if (index > 0ULL)
+			{
+				table.Categories[index].Level.store(
+					static_cast<uint8_t>(static_cast<LogSeverity>(category.second)),
+					std::memory_order_relaxed
+				);
+				fileCategories.push_back(
+					category.first
+				);
+			}
+		}
+
+		_RefreshCategories(
+			table
+		);
+		if (settings.HasPattern == true
+			|| filePattern == true)
+		{
+			_ConfigurePattern(
+				settings.HasPattern == true ? settings.Pattern : CurrentConfiguration().Pattern
+			);
+		}
+
+		filePattern = settings.HasPattern;
+		_PublishSettings(
+			CurrentConfiguration(),
+			rules
+		);
+	};
+
+	/**
+	* @brief Reads a configuration file and applies it. Only the settings given in the file are changed.
+	*
+	* The file consists of `key = value` lines; lines starting with '#' are ignored.
+	* - `level`: The level of every message without a category or filter rule (overrides `Severity`).
+	* - `filter`: A filter spec (see `LoggerConfiguration::Filter`).
+	* - `pattern`: A layout pattern (see `LoggerConfiguration::Pattern`).
+	* - `outputs`: Any of `console`, `file`, `json` or `none`, separated by ','. Outputs that are disabled in the configuration stay disabled.
+	* - `category.<name>`: The level of a category.
+	*
+	* @return True if the file was applied; false if it could not be read or is invalid, in which case nothing is changed.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline bool ReloadConfiguration(
+		const std::filesystem::path& path
+	) {
+		std::ifstream file(
+			path
+		);
+		if (file.is_open() == false)
+		{
+			return false;
+		}
+
+		_FileSettings settings = _FileSettings();
+		try
+		{
+			settings = _ParseConfigurationFile(
+				file
+			);
+		}
+		catch (const std::invalid_argument& exception)
+		{
+			std::source_location location = std::source_location::current();
+			WriteLog<"Configuration file {} was not applied: {}">(
+				LogLevels::Error,
+				location.file_name(),
+				std::to_string(location.line()),
+				location.function_name(),
+				path.string(),
+				exception.what()
+			);
+			return false;
+		}
+
+		_ApplyFileSettings(
+			settings
+		);
+		return true;
+	};
+
+	/**
+	* @brief Helper for configuration files. The file that is watched for changes. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	struct _ConfigWatcher final
+	{
+	public:
+		std::mutex Mutex = std::mutex();
+		std::filesystem::path Path = std::filesystem::path();
+		int Descriptor = -1;
+	};
+
+	/**
+	* @brief Helper for configuration files. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline _ConfigWatcher& _CurrentConfigWatcher()
+	{
+		static _ConfigWatcher watcher = _ConfigWatcher();
+
+		return watcher;
+	}
+
+#ifdef __linux__
+	/**
+	* @brief Helper for configuration files. Runs on the background worker whenever the directory of the file changes. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _OnConfigurationChanged(
+		_ConfigWatcher& watcher
+	) {
+		std::filesystem::path path = std::filesystem::path();
+		bool changed = false;
+		{
+			std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+				watcher.Mutex
+			);
+			alignas(inotify_event) char buffer[4096];
+			ssize_t length = read(
+				watcher.Descriptor,
+				buffer,
+				sizeof(buffer)
+			);
+			while (length > 0)
+			{
+				ssize_t offset = 0;
+				while (offset < length)
+				{
+					const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+					if (event->len > 0U
+						&& watcher.Path.filename() == event->name)
+					{
+						changed = true;
+					}
+
+					offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+				}
+
+				length = read(
+					watcher.Descriptor,
+					buffer,
+					sizeof(buffer)
+				);
+			}
+
+			path = watcher.Path;
+		}
+
+		if (changed == true)
+		{
+			ReloadConfiguration(
+				path
+			);
+		}
+	};
+#endif // __linux__
+
+	/**
+	* @brief Helper for configuration files. Applies the file and watches it for changes; an empty path stops watching. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _WatchConfigFile(
+		const std::filesystem::path& path
+	) {
+		_ConfigWatcher& watcher = _CurrentConfigWatcher();
+	#ifdef __linux__
+		int previous = -1;
+		{
+			std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+				watcher.Mutex
+			);
+			previous = watcher.Descriptor;
+			watcher.Descriptor = -1;
+			watcher.Path = path;
+		}
+
+		if (previous >= 0)
+		{
+			_RemoveWorkerDescriptor(
+				previous
+			);
+			close(previous);
+		}
+	#endif // __linux__
+
+		// Without a file everything a previous file changed is reverted
+		if (path.empty() == true)
+		{
+			_FileSettings settings = _FileSettings();
+			_ApplyFileSettings(
+				settings
+			);
+			return;
+		}
+
+		ReloadConfiguration(
+			path
+		);
+
+	#ifdef __linux__
+		// The directory is watched, since editors replace the file instead of writing it
+		int descriptor = inotify_init1(
+			IN_NONBLOCK | IN_CLOEXEC
+		);
+		if (descriptor < 0)
+		{
+			return;
+		}
+
+		std::filesystem::path directory = path.parent_path().empty() == true ? std::filesystem::path(".") : path.parent_path();
+		if (inotify_add_watch(descriptor, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) < 0)
+		{
+			close(descriptor);
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+				watcher.Mutex
+			);
+			watcher.Descriptor = descriptor;
+		}
+
+		_AddWorkerDescriptor(
+			descriptor,
+			[&watcher]()
+			{
+				_OnConfigurationChanged(
+					watcher
+				);
+			}
+		);
+	#endif // __linux__
+	};
+
+	/**
+	* @brief Writes everything the logger is still holding back (like the summary of a repeated message or the open rollup windows) and flushes the console.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void FlushLogger()
+	{
+		_ExpireDeduplicators(
+			true
+		);
+		_CloseRollups(
+			true
+		);
+		std::cout << std::flush;
+	};
+
+	/**
+	* @brief Helper for the control socket. Formats a level for a reply; levels that are not set are written as "default". Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline std::string_view _ControlLevelName(
+		uint8_t level
+	) {
+		if (level == _Category::Inherit)
+		{
+			return "default";
+		}
+
+		return LogLevel(static_cast<LogSeverity>(level)).ToString();
+	};
+
+	/**
+	* @brief Helper for the control socket. Runs a single command and returns the reply; every line of the reply ends with '\n' and errors start with "error:". Standalone use not supported.
+	*
+	* - `level`: Lists the level of every category ("*" is the level of messages without a category).
+	* - `level <category> <level|default>`: Sets the level of a category.
+	* - `sites`: Lists every call site that has been reached.
+	* - `site <location> <default|enabled|disabled>`: Overrides call sites (see `SetCallSiteState`).
+	* - `stats`: Reports what the logger has done so far.
+	* - `profile [bytes|time|hits] [count]`: Lists the call sites that cost the most (see `WriteProfileReport`).
+	* - `flush`: Writes everything the logger is holding back (see `FlushLogger`).
+	*
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline std::string _ExecuteControlCommand(
+		std::string_view command
+	) {
+		std::vector<std::string_view> words = std::vector<std::string_view>();
+		while (command.empty() == false)
+		{
+			size_t begin = command.find_first_not_of(
+				" \t\r"
+			);
+			if (begin == std::string_view::npos)
+			{
+				break;
+			}
+
+			command = command.substr(
+				begin
+			);
+			size_t end = command.find_first_of(
+				" \t\r"
+			);
+			words.push_back(
+				command.substr(0ULL, end)
+			);
+			command = end == std::string_view::npos ? std::string_view() : command.substr(end);
+		}
+
+		std::string reply = std::string();
+		if (words.empty() == true)
+		{
+			return "error: empty command\n";
+		}
+		else if (words[0] == "level"
+				 && words.size() == 1ULL)
+		{
+			_CategoryTable& table = _Categories();
+			std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+				table.Mutex
+			);
+			size_t count = table.Count.load(
+				std::memory_order_relaxed
+			);
+			size_t index = 0ULL;
+			while (index < count)
+			{
+				const _Category& category = table.Categories[index];
+				uint8_t level = category.EffectiveLevel.load(
+					std::memory_order_relaxed
+				);
+				reply += index == 0ULL ? std::string_view("*") : std::string_view(category.Name.data(), category.NameLength);
+				reply += ' ';
+				reply += level == _Category::Inherit ? CurrentConfiguration().Severity.ToString() : _ControlLevelName(level);
+				if (category.Level.load(std::memory_order_relaxed) == _Category::Inherit)
+				{
+					reply += " (inherited)";
+				}
+
+				reply += '\n';
+				index += 1ULL;
+			}
+		}
+		else if (words[0] == "level"
+				 && words.size() == 3ULL)
+		{
+			bool reset = words[2] == "default";
+			LogLevel level = LogLevels::Disabled;
+			if (reset == false)
+			{
+				// Accepts the same levels as a filter spec (including "off")
+				std::vector<_FilterRule> rules = std::vector<_FilterRule>();
+				try
+				{
+					rules = _CompileFilter(
+						words[2]
+					);
+				}
+				catch (const std::invalid_argument&)
+				{
+				}
+
+				if (rules.size() != 1ULL
+					|| rules[0].Pattern.empty() == false)
+				{
+					return "error: unknown level\n";
+				}
+
+				level = rules[0].Level;
+			}
+
+			if (words[1] == "*")
+			{
+				// The root level is part of the settings snapshot, so it is published like a configuration
+				_Filter& filter = _CurrentFilter();
+				_CategoryTable& table = _Categories();
+				std::lock_guard<std::mutex> filterLock = std::lock_guard<std::mutex>(
+					filter.Mutex
+				);
+				std::lock_guard<std::mutex> categoryLock = std::lock_guard<std::mutex>(
+					table.Mutex
+				);
+				table.Categories[0].Level.store(
+					reset == true ? _Category::Inherit : static_cast<uint8_t>(static_cast<LogSeverity>(level)),
+					std::memory_order_relaxed
+				);
+				_RefreshCategories(
+					table
+				);
+				_PublishSettings(
+					CurrentConfiguration(),
+					_CurrentSettings().Rules
+				);
+			}
+			else if (reset == true)
+			{
+				ResetCategoryLevel(
+					words[1]
+				);
+			}
+			else
+			{
+				SetCategoryLevel(
+					words[1],
+					level
+				);
+			}
+
+			reply = "ok\n";
+		}
+		else if (words[0] == "sites"
+				 && words.size() == 1ULL)
+		{
+			for (const CallSiteInfo& site : ListCallSites())
+			{
+				reply += site.Module;
+				reply += ':';
+				reply += site.Line;
+				reply += ' ';
+				reply += site.Function;
+				reply += ' ';
+				reply += site.Level.ToString();
+				reply += ' ';
+				reply += site.State == CallSiteState::Enabled ? "enabled" : site.State == CallSiteState::Disabled ? "disabled" : "default";
+				reply += ' ';
+				reply += std::to_string(site.Hits);
+				reply += ' ';
+				_AppendEscaped(
+					reply,
+					site.Template,
+					_EscapeMode::Text
+				);
+				reply += '\n';
+			}
+		}
+		else if (words[0] == "site"
+				 && words.size() == 3ULL)
+		{
+			CallSiteState state = CallSiteState::Default;
+			if (words[2] == "enabled")
+			{
+				state = CallSiteState::Enabled;
+			}
+			else if (words[2] == "disabled")
+			{
+				state = CallSiteState::Disabled;
+			}
+			else if (words[2] != "default")
+			{
+				return "error: unknown state\n";
+			}
+
+			reply = std::to_string(SetCallSiteState(words[1], state));
+			reply += " call sites changed\n";
+		}
+		else if (words[0] == "stats"
+				 && words.size() == 1ULL)
+		{
+			uint64_t sites = 0ULL;
+			uint64_t hits = 0ULL;
+			for (const CallSiteInfo& site : ListCallSites())
+			{
+				sites += 1ULL;
+				hits += site.Hits;
+			}
+
+			reply += "call_sites ";
+			reply += std::to_string(sites);
+			reply += "\ncalls ";
+			reply += std::to_string(hits);
+			reply += '\n';
+
+			// Per level, levels without records are left out
+			LoggerStatistics statistics = Statistics();
+			auto counters = [&reply](std::string_view name, const std::array<uint64_t, LoggerStatistics::LevelCount>& values)
+			{
+				size_t index = 1ULL;
+				while (index < LoggerStatistics::LevelCount)
+				{
+					if (values[index] > 0ULL)
+					{
+						reply += name;
+						reply += '.';
+						reply += LogLevel(static_cast<LogSeverity>(index)).ToString();
+						reply += ' ';
+						reply += std::to_string(values[index]);
+						reply += '\n';
+					}
+
+					index += 1ULL;
+				}
+			};
+			counters("accepted", statistics.Accepted);
+			counters("filtered", statistics.Filtered);
+			counters("dropped", statistics.Dropped);
+			counters("deduplicated", statistics.Deduplicated);
+			counters("written", statistics.Written);
+			reply += "bytes_written ";
+			reply += std::to_string(statistics.BytesWritten);
+			reply += '\n';
+
+			auto latency = [&reply](std::string_view name, const LatencyHistogram& histogram)
+			{
+				reply += name;
+				reply += "_ns p50=";
+				reply += std::to_string(histogram.Percentile(50.0));
+				reply += " p99=";
+				reply += std::to_string(histogram.Percentile(99.0));
+				reply += " max=";
+				reply += std::to_string(histogram.Max);
+				reply += " count=";
+				reply += std::to_string(histogram.Count);
+				reply += '\n';
+			};
+			latency("call_time", statistics.CallTime);
+			latency("write_time", statistics.WriteTime);
+			latency("flush_time", statistics.FlushTime);
+
+			// Records are written synchronously, so there is never a queue
+			reply += "queue_depth 0\n";
+		}
+		else if (words[0] == "profile"
+				 && words.size() <= 3ULL)
+		{
+			ProfileOrder order = ProfileOrder::Bytes;
+			if (words.size() > 1ULL
+				&& words[1] == "time")
+			{
+				order = ProfileOrder::Time;
+			}
+			else if (words.size() > 1ULL
+					 && words[1] == "hits")
+			{
+				order = ProfileOrder::Hits;
+			}
+			else if (words.size() > 1ULL
+					 && words[1] != "bytes")
+			{
+				return "error: unknown order\n";
+			}
+
+			size_t count = 5ULL;
+			if (words.size() > 2ULL)
+			{
+				count = static_cast<size_t>(std::strtoull(std::string(words[2]).c_str(), nullptr, 10));
+			}
+
+			std::stringstream stream = std::stringstream();
+			WriteProfileReport(
+				stream,
+				count,
+				order
+			);
+			reply = stream.str();
+		}
+		else if (words[0] == "flush"
+				 && words.size() == 1ULL)
+		{
+			FlushLogger();
+			reply = "ok\n";
+		}
+		else if (words[0] == "rotate"
+				 && words.size() == 1ULL)
+		{
+			// Files are opened for every record and named by date
+			reply = "error: log files rotate daily and are never held open\n";
+		}
+		else
+		{
+			reply = "error: unknown command\n";
+		}
+
+		return reply;
 	};
 
+#ifdef __linux__
 	/**
-	* @brief Gets the current configuration for the logger.
+	* @brief Helper for the control socket. A connected client and the part of its command that has been received so far. Standalone use not supported.
 	* @author Narumikazuchi
-	* @date 01.07.2025
+	* @date 16.10.2026
 	*/
-	inline LoggerConfiguration& CurrentConfiguration()
+	struct _ControlConnection final
 	{
-		static LoggerConfiguration configuration = LoggerConfiguration();
+	public:
+		static constexpr size_t MaximumCommandLength = 4096ULL;
 
-		return configuration;
-	}
+		int Descriptor = -1;
+		std::string Received = std::string();
+	};
 
 	/**
-	* @brief Configures the logger variables (where to store files, which severity level to log).
+	* @brief Helper for the control socket. Runs on the background worker whenever a client has sent something; every line is a command. Standalone use not supported.
 	* @author Narumikazuchi
-	* @date 01.07.2025
+	* @date 16.10.2026
 	*/
-	inline void ConfigureLogger(
-		const LoggerConfiguration& configuration
+	inline void _ServeControlConnection(
+		_ControlConnection& connection
 	) {
-		CurrentConfiguration() = configuration;
+		char buffer[1024];
+		ssize_t length = read(
+			connection.Descriptor,
+			buffer,
+			sizeof(buffer)
+		);
+		if (length > 0)
+		{
+			connection.Received.append(
+				buffer,
+				static_cast<size_t>(length)
+			);
+		}
 
-		if (configuration.LogDirectory.empty() == true)
+		bool closing = length == 0
+					   || (length < 0 && errno != EAGAIN && errno != EINTR);
+		size_t newline = connection.Received.find(
+			'\n'
+		);
+		while (closing == false
+			   && newline != std::string::npos)
 		{
-			static std::filesystem::path userDirectory = std::filesystem::path();
+			std::string reply = _ExecuteControlCommand(
+				std::string_view(connection.Received).substr(0ULL, newline)
+			);
+			connection.Received.erase(
+				0ULL,
+				newline + 1ULL
+			);
 
-			if (userDirectory.empty() == true)
+			// Writes time out, so a client that does not read cannot stall the worker
+			size_t written = 0ULL;
+			while (written < reply.size())
 			{
-				std::string rawPath = std::string();
-				std::filesystem::path path = std::filesystem::path();
-
-		#ifdef _WIN32
-				PWSTR winPath = nullptr;
-				if (SUCCEEDED(SHGetKnownFolderPath(FOLDERID_Documents, 0, nullptr, &winPath)))
-				{
-					std::wstring wString = std::wstring(
-						winPath
-					);
-					CoTaskMemFree(
-						winPath
-					);
-					rawPath = std::string(
-						(const char*)wString.data(),
-						wString.size()
-					);
-					path = wString;
-				}
-		#elif __linux__
-				const char* homeDir = std::getenv(
-					"HOME"
+				ssize_t result = send(
+					connection.Descriptor,
+					reply.data() + written,
+					reply.size() - written,
+					MSG_NOSIGNAL
 				);
-				if (homeDir == nullptr)
+				if (result <= 0)
 				{
-					return;
+					closing = true;
+					break;
 				}
 
-				path = homeDir;
-				path = path / "Documents";
-		#endif // _WIN32 or __linux__
-
-				userDirectory = path;
+				written += static_cast<size_t>(result);
 			}
 
-			CurrentConfiguration().LogDirectory = userDirectory;
+			newline = connection.Received.find(
+				'\n'
+			);
+		}
+
+		if (connection.Received.size() > _ControlConnection::MaximumCommandLength)
+		{
+			closing = true;
 		}
 
-		if (std::filesystem::exists(CurrentConfiguration().LogDirectory) == false)
+		if (closing == true)
 		{
-			std::filesystem::create_directories(
-				CurrentConfiguration().LogDirectory
+			_RemoveWorkerDescriptor(
+				connection.Descriptor
 			);
+			close(connection.Descriptor);
 		}
 	};
 
 	/**
-	* @brief Helper function for logging. Standalone use not supported.
+	* @brief Helper for the control socket. Runs on the background worker whenever a client connects. Standalone use not supported.
 	* @author Narumikazuchi
-	* @date 06.05.2025
+	* @date 16.10.2026
 	*/
-	template <size_t NSize, typename TArgument>
-	inline void UnrollArgument(
-		std::array<std::string, NSize>& strings,
-		size_t index,
-		TArgument&& argument
+	inline void _AcceptControlConnection(
+		int listener
 	) {
-		if constexpr (_StringLike<std::remove_reference_t<decltype(argument)>> == true)
+		int descriptor = accept4(
+			listener,
+			nullptr,
+			nullptr,
+			SOCK_CLOEXEC
+		);
+		if (descriptor < 0)
 		{
-			if constexpr (std::is_same_v<std::string, decltype(argument)> == true
-						  || std::is_same_v<std::string&, decltype(argument)> == true
-						  || std::is_same_v<const std::string&, decltype(argument)> == true)
-			{
-				strings[index] = argument;
-			}
-			else
+			return;
+		}
+
+		timeval timeout = timeval{ 1, 0 };
+		setsockopt(
+			descriptor,
+			SOL_SOCKET,
+			SO_SNDTIMEO,
+			&timeout,
+			sizeof(timeout)
+		);
+		std::shared_ptr<_ControlConnection> connection = std::make_shared<_ControlConnection>();
+		connection->Descriptor = descriptor;
+		_AddWorkerDescriptor(
+			descriptor,
+			[connection]()
 			{
-				strings[index] = std::string(
-					argument
+				_ServeControlConnection(
+					*connection
 				);
 			}
+		);
+	};
+#endif // __linux__
+
+	/**
+	* @brief Helper for the control socket. Listens on the given path; an empty path closes the socket. Connected clients are served until they disconnect. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _ServeControlSocket(
+		const std::filesystem::path& path
+	) {
+	#ifdef __linux__
+		static std::mutex mutex = std::mutex();
+		static std::filesystem::path current = std::filesystem::path();
+		static int listener = -1;
+
+		std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+			mutex
+		);
+		if (path == current
+			&& (listener >= 0 || path.empty() == true))
+		{
+			return;
 		}
-		else if constexpr (_StringConvertible<std::remove_reference_t<decltype(argument)>> == true)
+
+		if (listener >= 0)
 		{
-			strings[index] = std::string(
-				argument
+			_RemoveWorkerDescriptor(
+				listener
 			);
+			close(listener);
+			unlink(current.c_str());
+			listener = -1;
 		}
-		else if constexpr (_StringCastable<std::remove_reference_t<decltype(argument)>> == true)
+
+		current = path;
+		sockaddr_un address = sockaddr_un();
+		address.sun_family = AF_UNIX;
+		if (path.empty() == true
+			|| path.native().size() >= sizeof(address.sun_path))
 		{
-			strings[index] = static_cast<std::string>(argument);
+			return;
 		}
-		else if constexpr (_StdStringify<std::remove_reference_t<decltype(argument)>> == true)
+
+		std::memcpy(
+			address.sun_path,
+			path.c_str(),
+			path.native().size()
+		);
+		int descriptor = socket(
+			AF_UNIX,
+			SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC,
+			0
+		);
+		if (descriptor < 0)
 		{
-			std::string temp = std::to_string(
-				argument
-			);
-			strings[index] = temp;
+			return;
 		}
-		else if constexpr (_Stringify<std::remove_reference_t<decltype(argument)>> == true)
+
+		// A socket left behind by a previous process would make bind fail
+		unlink(path.c_str());
+		if (bind(descriptor, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0
+			|| listen(descriptor, 8) != 0)
 		{
-			auto& value = argument.ToString();
-			if constexpr (std::is_same_v<std::string, decltype(value)> == true
-						  || std::is_same_v<std::string&, decltype(value)> == true
-						  || std::is_same_v<const std::string&, decltype(value)> == true)
-			{
-				strings[index] = value;
-			}
-			else
+			close(descriptor);
+			return;
+		}
+
+		listener = descriptor;
+		_AddWorkerDescriptor(
+			descriptor,
+			[descriptor]()
 			{
-				strings[index] = std::string(
-					value
+				_AcceptControlConnection(
+					descriptor
 				);
 			}
-		}
-		else if constexpr (_StringAppendable<std::remove_reference_t<decltype(argument)>> == true)
-		{
-			std::string temp = std::string();
-			temp += argument;
-			strings[index] = temp;
-		}
+		);
+	#else
+		static_cast<void>(path);
+	#endif // __linux__
 	};
 
 	/**
-	* @brief Helper function for logging. Standalone use not supported.
+	* @brief Helper for the metrics exporter. Writes a latency histogram as a Prometheus summary. Standalone use not supported.
 	* @author Narumikazuchi
-	* @date 06.05.2025
+	* @date 16.10.2026
 	*/
-	template <size_t NSize, typename TTuple, size_t... NIndecies>
-	inline void UnrollArguments(
-		std::array<std::string, NSize>& strings,
-		TTuple&& tuple,
-		std::index_sequence<NIndecies...>
+	inline void _AppendSummary(
+		std::string& output,
+		std::string_view name,
+		std::string_view help,
+		const LatencyHistogram& histogram
 	) {
-		(UnrollArgument(
-			strings,
-			NIndecies,
-			std::get<NIndecies>(tuple)
-		),
-		...);
+		output += "# HELP ";
+		output += name;
+		output += ' ';
+		output += help;
+		output += "\n# TYPE ";
+		output += name;
+		output += " summary\n";
+		char buffer[64];
+		for (const double quantile : { 0.5, 0.9, 0.99, 0.999 })
+		{
+			output += name;
+			std::snprintf(
+				buffer,
+				sizeof(buffer),
+				"{quantile=\"%g\"} %.9g\n",
+				quantile,
+				static_cast<double>(histogram.Percentile(quantile * 100.0)) / 1e9
+			);
+			output += buffer;
+		}
+
+		output += name;
+		std::snprintf(
+			buffer,
+			sizeof(buffer),
+			"_sum %.9g\n",
+			static_cast<double>(histogram.Sum) / 1e9
+		);
+		output += buffer;
+		output += name;
+		output += "_count ";
+		output += std::to_string(histogram.Count);
+		output += '\n';
 	};
 
 	/**
-	* @brief Writes a message to the log file with variable arguments.
-	*
-	* This function writes a log message to the logger's output stream, which is usually a text file. The message includes the severity level, module name, function name, and a formatted string with optional arguments.
-	*
-	* @param level The LogLevel of the message.
-	* @param module The name of the module that generated the message.
-	* @param line The line number where in the module the log is happening.
-	* @param function The name of the function that generated the message.
-	* @param arguments The variable arguments to pass to the formatting function.
+	* @brief Writes the statistics of the logger in the Prometheus text format. The file is replaced atomically, so a collector never reads a partial file.
+	* @return True if the file was written; otherwise false.
 	* @author Narumikazuchi
-	* @date 01.07.2025
+	* @date 16.10.2026
 	*/
-	template <StringLiteral STemplate, _Loggable... TArguments>
-		requires (PlaceholderCountMatchesArgumentCount<STemplate, TArguments...>())
-	inline void WriteLog(
-		const LogLevel level,
-		const std::string& module,
-		const std::string& line,
-		const std::string& function,
-		TArguments&&... arguments
+	inline bool ExportMetrics(
+		const std::filesystem::path& path
 	) {
-		// Check if log level is satisfied
-		if (level > CurrentConfiguration().Severity)
-		{
-			return;
-		}
-
-		if (CurrentConfiguration().WriteToConsole == false
-			&& CurrentConfiguration().WriteToFile == false
-		) {
-			return;
-		}
-
-		// Fetch current time
-		std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
-		time_t time = std::chrono::system_clock::to_time_t(
-			now
-		);
-		std::tm tm;
-	#ifdef _WIN32
-		if (localtime_s(&tm, &time) != 0)
-	#elif __linux__
-		if (localtime_r(&time, &tm) == nullptr)
-	#endif
+		LoggerStatistics statistics = Statistics();
+		std::string output = std::string();
+		// Each family splits its records into outcomes that do not overlap, so the outcomes of a family add up
+		auto records = [&output](std::string_view family, std::string_view outcome, const std::array<uint64_t, LoggerStatistics::LevelCount>& values)
 		{
-			tm = std::tm();
-		}
+			size_t index = 1ULL;
+			while (index < LoggerStatistics::LevelCount)
+			{
+				output += family;
+				output += "{level=\"";
+				for (char character : LogLevel(static_cast<LogSeverity>(index)).ToString())
+				{
+					output.push_back(
+						static_cast<char>(std::tolower(static_cast<unsigned char>(character)))
+					);
+				}
 
-		// Start to format message
-		std::string timestamp = std::string();
-		std::string severity = std::string();
-		std::string message = std::string();
+				if (outcome.empty() == false)
+				{
+					output += "\",outcome=\"";
+					output += outcome;
+				}
 
-		// Timestamp
-		if (tm.tm_hour < 10)
-		{
-			timestamp += "0";
-		}
+				output += "\"} ";
+				output += std::to_string(values[index]);
+				output += '\n';
+				index += 1ULL;
+			}
+		};
+		output += "# HELP simplelog_records_total Logging calls by level and whether they passed the level check.\n";
+		output += "# TYPE simplelog_records_total counter\n";
+		records("simplelog_records_total", "accepted", statistics.Accepted);
+		records("simplelog_records_total", "filtered", statistics.Filtered);
+		output += "# HELP simplelog_discarded_records_total Accepted records that were not written, by level and why.\n";
+		output += "# TYPE simplelog_discarded_records_total counter\n";
+		records("simplelog_discarded_records_total", "dropped", statistics.Dropped);
+		records("simplelog_discarded_records_total", "deduplicated", statistics.Deduplicated);
+		output += "# HELP simplelog_written_records_total Records written to at least one output by level, including summaries and the backtrace.\n";
+		output += "# TYPE simplelog_written_records_total counter\n";
+		records("simplelog_written_records_total", std::string_view(), statistics.Written);
+		output += "# HELP simplelog_written_bytes_total Bytes written over all outputs.\n";
+		output += "# TYPE simplelog_written_bytes_total counter\n";
+		output += "simplelog_written_bytes_total ";
+		output += std::to_string(statistics.BytesWritten);
+		output += '\n';
 
-		timestamp += std::to_string(
-			tm.tm_hour
+		// Records are written synchronously, so there is never a queue
+		output += "# HELP simplelog_queue_depth Records waiting to be written.\n";
+		output += "# TYPE simplelog_queue_depth gauge\n";
+		output += "simplelog_queue_depth 0\n";
+		_AppendSummary(
+			output,
+			"simplelog_call_seconds",
+			"Time spent inside WriteLog for accepted records.",
+			statistics.CallTime
 		);
-		timestamp += ":";
-		if (tm.tm_min < 10)
-		{
-			timestamp += "0";
-		}
-
-		timestamp += std::to_string(
-			tm.tm_min + 1
+		_AppendSummary(
+			output,
+			"simplelog_write_seconds",
+			"Time to write a record to every output.",
+			statistics.WriteTime
 		);
-		timestamp += ":";
-		if (tm.tm_sec < 10)
-		{
-			timestamp += "0";
-		}
-
-		timestamp += std::to_string(
-			tm.tm_sec + 1
+		_AppendSummary(
+			output,
+			"simplelog_flush_seconds",
+			"Time to write and flush a single file.",
+			statistics.FlushTime
 		);
 
-		// LogLevel
-		size_t characters = level.ToString().size();
-		severity += level.ToString();
-		while (characters < 12ULL)
+		std::filesystem::path temporary = path;
+		temporary += ".tmp";
 		{
-			severity += " ";
-			characters += 1ULL;
-		}
+			std::ofstream file(
+				temporary,
+				std::ios_base::out | std::ios_base::trunc
+			);
+			if (file.is_open() == false)
+			{
+				return false;
+			}
 
-		// Thread ID
-		if (CurrentConfiguration().WriteThreadId == true)
-		{
-			std::stringstream id = std::stringstream();
-			id << std::this_thread::get_id();
-			message += "Thread #";
-			message += id.str();
-			message += "\t\t";
+			file << output << std::flush;
+			if (file.good() == false)
+			{
+				return false;
+			}
 		}
 
-		// Module
-		std::string moduleFile = std::string();
-		size_t index = module.find_last_of(
-			'/'
+		std::error_code error = std::error_code();
+		std::filesystem::rename(
+			temporary,
+			path,
+			error
+		);
+		return static_cast<bool>(error) == false;
+	};
+
+	/**
+	* @brief Helper for the metrics exporter. Exports the metrics periodically on the background worker; an empty path stops exporting. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _ConfigureMetricsExporter(
+		const std::filesystem::path& path,
+		std::chrono::milliseconds interval
+	) {
+	#ifdef __linux__
+		static std::mutex mutex = std::mutex();
+		static int timer = -1;
+
+		std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+			mutex
 		);
-		if (index == std::string::npos)
+		if (timer >= 0)
 		{
-			index = module.find_last_of(
-				'\\'
+			_RemoveWorkerDescriptor(
+				timer
 			);
+			close(timer);
+			timer = -1;
 		}
 
-		if (index == std::string::npos)
-		{
-			index = 0ULL;
-		}
-		else
+		if (path.empty() == true)
 		{
-			index += 1ULL;
+			return;
 		}
 
-		moduleFile = module.substr(
-			index
+		// The worker waits on a timer like on any other descriptor
+		int descriptor = timerfd_create(
+			CLOCK_MONOTONIC,
+			TFD_NONBLOCK | TFD_CLOEXEC
 		);
-		characters = moduleFile.size() + line.size() + 1ULL;
-		message += moduleFile;
-		message += ":";
-		message += line;
-		while (characters < 64ULL)
+		if (descriptor < 0)
 		{
-			message += " ";
-			characters += 1ULL;
+			return;
 		}
 
-		message += "\t\t";
-
-		// Function
-		characters = function.size();
-		message += function;
-		while (characters < 32ULL)
+		interval = std::max<std::chrono::milliseconds>(
+			interval,
+			std::chrono::milliseconds(1)
+		);
+		itimerspec specification = itimerspec();
+		specification.it_interval.tv_sec = static_cast<time_t>(interval.count() / 1000LL);
+		specification.it_interval.tv_nsec = static_cast<long>(interval.count() % 1000LL) * 1000000L;
+		specification.it_value = specification.it_interval;
+		if (timerfd_settime(descriptor, 0, &specification, nullptr) != 0)
 		{
-			message += " ";
-			characters += 1ULL;
+			close(descriptor);
+			return;
 		}
 
-		message += "\t\t";
-
-		// Format Message
-		std::array<std::string, sizeof...(TArguments)> unrolledArguments = { };
-		UnrollArguments(
-			unrolledArguments,
-			std::make_tuple(
-				std::forward<TArguments>(arguments)...
-			),
-			std::make_index_sequence<sizeof...(TArguments)>()
-		);
-
-		char lastCharacter = 0;
-		size_t argumentIndex = 0ULL;
-
-		index = 0ULL;
-		constexpr size_t count = sizeof(STemplate.Value) - 1ULL; // Exclude \0 character
-		while (index < count)
-		{
-			char character = STemplate.Value[index];
-			if (character == '{'
-				&& lastCharacter == '{')
-			{
-				message += '{';
-			}
-			else if (character == '}'
-					 && lastCharacter == '}')
-			{
-				message += '}';
-			}
-			else if (character == '}'
-					 && lastCharacter == '{')
-			{
-				if (argumentIndex >= sizeof...(TArguments))
-				{
-					throw std::runtime_error(
-						"Not enough arguments passed to satisfy message template."
-					);
-				}
-			
-				message += unrolledArguments[argumentIndex];
-				argumentIndex += 1ULL;
-			}
-			else if (character != '{'
-					 && character != '}')
+		timer = descriptor;
+		_AddWorkerDescriptor(
+			descriptor,
+			[descriptor, path]()
 			{
-				message += character;
+				uint64_t expirations = 0ULL;
+				static_cast<void>(read(descriptor, &expirations, sizeof(expirations)));
+				ExportMetrics(
+					path
+				);
 			}
+		);
+	#else
+		static_cast<void>(path);
+		static_cast<void>(interval);
+	#endif // __linux__
+	};
 
-			lastCharacter = character;
-			index += 1ULL;
-		}
+	/**
+	* @brief Helper for rollups and duplicate suppression. Lets the background worker close rollup windows and runs of repeated messages that have passed, so their summaries do not wait for the next message. Standalone use not supported.
+	* @author Narumikazuchi
+	* @date 16.10.2026
+	*/
+	inline void _StartHousekeeping()
+	{
+	#ifdef __linux__
+		static std::mutex mutex = std::mutex();
+		static int timer = -1;
 
-		// Write to console
-		if (CurrentConfiguration().WriteToConsole == true)
+		std::lock_guard<std::mutex> lock = std::lock_guard<std::mutex>(
+			mutex
+		);
+		if (timer >= 0)
 		{
-			std::cout << timestamp << "\t\t[";
-			switch (level)
-			{
-				case LogLevels::Debug:
-				{
-					std::cout << "\033[36";
-					break;
-				}
-				case LogLevels::Information:
-				{
-					std::cout << "\033[32";
-					break;
-				}
-				case LogLevels::Warning:
-				{
-					std::cout << "\033[33";
-					break;
-				}
-				case LogLevels::Error:
-				{
-					std::cout << "\033[31";
-					break;
-				}
-				case LogLevels::Critical:
-				{
-					std::cout << "\033[41";
-					break;
-				}
-				default:
-				{
-					break;
-				}
-			}
-
-			std::cout << severity << "]\033[m\t\t" << message << "\n" << std::flush;
+			return;
 		}
 
-		// Check if log directory has been set
-		if (CurrentConfiguration().WriteToFile == false
-			|| CurrentConfiguration().LogDirectory.empty() == true
-		) {
+		int descriptor = timerfd_create(
+			CLOCK_MONOTONIC,
+			TFD_NONBLOCK | TFD_CLOEXEC
+		);
+		if (descriptor < 0)
+		{
 			return;
 		}
 
-		// Generate filename
-		std::filesystem::path filePath = std::filesystem::path();
-		if (tm.tm_year == 0)
+		// Summaries are written at most 100 ms after their window or interval has passed
+		itimerspec specification = itimerspec();
+		specification.it_interval.tv_nsec = 100000000L;
+		specification.it_value = specification.it_interval;
+		if (timerfd_settime(descriptor, 0, &specification, nullptr) != 0)
 		{
-			std::string filename = CurrentConfiguration().FileNamePrefix;
-			filename += "General";
-			filename += CurrentConfiguration().FileNamePostfix;
-			filename += ".log";
-			filePath = CurrentConfiguration().LogDirectory / filename;
+			close(descriptor);
+			return;
 		}
-		else
-		{
-			filePath = CurrentConfiguration().LogDirectory;
-			std::string filename = std::string();
-			filename += CurrentConfiguration().FileNamePrefix;
-			filename += std::to_string(
-				tm.tm_year + 1900
-			);
-			filename += "_";
-			if (tm.tm_mon < 9)
-			{
-				filename += "0";
-			}
-			
-			filename += std::to_string(
-				tm.tm_mon + 1
-			);
-			filename += "_";
-			if (tm.tm_mday < 10)
+
+		timer = descriptor;
+		_AddWorkerDescriptor(
+			descriptor,
+			[descriptor]()
 			{
-				filename += "0";
+				uint64_t expirations = 0ULL;
+				static_cast<void>(read(descriptor, &expirations, sizeof(expirations)));
+				_CloseRollups(
+					false
+				);
+				_ExpireDeduplicators(
+					false
+				);
 			}
-			
-			filename += std::to_string(
-				tm.tm_mday
-			);
-			filename += CurrentConfiguration().FileNamePostfix;
-			filename += ".log";
-			filePath /= filename;
-		}
-
-		// Log to file
-		std::ofstream file(
-			filePath,
-			std::ios_base::out | std::ios_base::app
 		);
-
-		if (file.is_open() == true)
-		{
-			file << timestamp << "\t\t[" << severity << "]\t\t" << message << "\n" << std::flush;
-			file.close();
-		}
+	#endif // __linux__
 	};
-
-	// Weird macro magic to get the line number
-	#define STRINGIFY(x) #x
-	#define AS_STRING(x) STRINGIFY(x)
-	#define LINE_AS_STRING AS_STRING(__LINE__)
-
-	// Logging functions for easier use (__FILE__, __LINE__ and __func__ are automatically included)
-	#define LogTrace(template, ...) WriteLog<template>(SimpleLog::LogLevels::Trace, __FILE__, LINE_AS_STRING, __func__ __VA_OPT__(,) __VA_ARGS__)
-	#define LogDebug(template, ...) WriteLog<template>(SimpleLog::LogLevels::Debug, __FILE__, LINE_AS_STRING, __func__ __VA_OPT__(,) __VA_ARGS__)
-	#define LogInformation(template, ...) WriteLog<template>(SimpleLog::LogLevels::Information, __FILE__, LINE_AS_STRING, __func__ __VA_OPT__(,) __VA_ARGS__)
-	#define LogWarning(template, ...) WriteLog<template>(SimpleLog::LogLevels::Warning, __FILE__, LINE_AS_STRING, __func__ __VA_OPT__(,) __VA_ARGS__)
-	#define LogError(template, ...) WriteLog<template>(SimpleLog::LogLevels::Error, __FILE__, LINE_AS_STRING, __func__ __VA_OPT__(,) __VA_ARGS__)
-	#define LogCritical(template, ...) WriteLog<template>(SimpleLog::LogLevels::Critical, __FILE__, LINE_AS_STRING, __func__ __VA_OPT__(,) __VA_ARGS__)
-}
\ No newline at end of file
+}
+SIMPLELOG_VISIBILITY_END
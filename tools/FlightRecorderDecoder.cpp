@@ -0,0 +1,27 @@
+#include "../source/SimpleLog.ipp"
+
+/**
+* @brief Prints the contents of a SimpleLog flight recorder file in the normal text layout.
+* @author Narumikazuchi
+* @date 16.10.2026
+*/
+int main(
+	int argc,
+	char** argv
+) {
+	if (argc < 2)
+	{
+		std::cerr << "Usage: " << argv[0] << " <flight recorder file> [--no-thread-id]\n";
+		return 2;
+	}
+
+	bool writeThreadId = argc < 3
+						 || std::string_view(argv[2]) != "--no-thread-id";
+	if (SimpleLog::DecodeFlightRecorder(argv[1], std::cout, writeThreadId) == false)
+	{
+		std::cerr << "Could not read flight recorder file " << argv[1] << "\n";
+		return 1;
+	}
+
+	return 0;
+}
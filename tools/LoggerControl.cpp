@@ -0,0 +1,118 @@
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/**
+* @brief Sends a single command to the control socket of a running SimpleLog logger and prints the reply.
+* @author Narumikazuchi
+* @date 16.10.2026
+*/
+int main(
+	int argc,
+	char** argv
+) {
+	if (argc < 3)
+	{
+		std::cerr << "Usage: " << argv[0] << " <control socket> <command> [arguments...]\n"
+				  << "Commands:\n"
+				  << "  level                                       Lists the level of every category\n"
+				  << "  level <category|*> <level|default>          Sets the level of a category\n"
+				  << "  sites                                       Lists every call site\n"
+				  << "  site <location> <default|enabled|disabled>  Overrides call sites\n"
+				  << "  stats                                       Reports what the logger has done so far\n"
+				  << "  flush                                       Writes everything that is held back\n";
+		return 2;
+	}
+
+	sockaddr_un address = sockaddr_un();
+	address.sun_family = AF_UNIX;
+	std::string_view path = std::string_view(argv[1]);
+	if (path.size() >= sizeof(address.sun_path))
+	{
+		std::cerr << "The path of the control socket is too long\n";
+		return 2;
+	}
+
+	std::memcpy(
+		address.sun_path,
+		path.data(),
+		path.size()
+	);
+	int descriptor = socket(
+		AF_UNIX,
+		SOCK_STREAM,
+		0
+	);
+	if (descriptor < 0
+		|| connect(descriptor, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+	{
+		std::cerr << "Could not connect to " << path << ": " << std::strerror(errno) << "\n";
+		return 1;
+	}
+
+	std::string command = std::string();
+	for (int index = 2; index < argc; index += 1)
+	{
+		if (index > 2)
+		{
+			command += ' ';
+		}
+
+		command += argv[index];
+	}
+
+	command += '\n';
+	size_t written = 0ULL;
+	while (written < command.size())
+	{
+		ssize_t result = send(
+			descriptor,
+			command.data() + written,
+			command.size() - written,
+			MSG_NOSIGNAL
+		);
+		if (result <= 0)
+		{
+			std::cerr << "Could not send the command: " << std::strerror(errno) << "\n";
+			close(descriptor);
+			return 1;
+		}
+
+		written += static_cast<size_t>(result);
+	}
+
+	// The logger answers every command and closes the connection once we are done sending
+	shutdown(
+		descriptor,
+		SHUT_WR
+	);
+	std::string reply = std::string();
+	char buffer[4096];
+	ssize_t length = read(
+		descriptor,
+		buffer,
+		sizeof(buffer)
+	);
+	while (length > 0)
+	{
+		reply.append(
+			buffer,
+			static_cast<size_t>(length)
+		);
+		length = read(
+			descriptor,
+			buffer,
+			sizeof(buffer)
+		);
+	}
+
+	close(descriptor);
+	std::cout << reply;
+	return reply.starts_with("error:") == true ? 1 : 0;
+}